@@ -0,0 +1,539 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+// Headless benchmarks for the runtime's hot paths, run over every .riv file
+// in a directory (test/assets by default):
+//
+//   import    File::import
+//   instance  File::artboardDefault()
+//   advance   Scene::advanceAndApply at 60 Hz, per frame
+//   draw      Scene::draw into a renderer that only counts calls, per frame
+//
+// Each metric reports the median wall time over --iterations runs (per frame
+// for advance and draw) along with the heap allocations, count and bytes, a
+// single run makes (across all --frames for advance and draw). Results are
+// written as JSON, one result per line so they are easy to diff. Passing
+// --compare with a previous run's JSON reports every metric that got slower
+// by more than --threshold, or that allocates more, and exits with 1 if any
+// did.
+
+#include "rive/file.hpp"
+#include "rive/artboard.hpp"
+#include "rive/renderer.hpp"
+#include "rive/scene.hpp"
+#include "utils/no_op_factory.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Every allocation made through operator new is counted so each metric can
+// report how much it allocates, not just how long it takes.
+static std::atomic<uint64_t> g_allocCount{0};
+static std::atomic<uint64_t> g_allocBytes{0};
+
+static void* countedAlloc(size_t size)
+{
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    g_allocBytes.fetch_add(size, std::memory_order_relaxed);
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new(size_t size) { return countedAlloc(size); }
+void* operator new[](size_t size) { return countedAlloc(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return countedAlloc(size);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, tag);
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+
+using namespace rive;
+
+namespace
+{
+struct Allocations
+{
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+
+    static Allocations now()
+    {
+        return {g_allocCount.load(std::memory_order_relaxed),
+                g_allocBytes.load(std::memory_order_relaxed)};
+    }
+
+    Allocations operator-(const Allocations& other) const
+    {
+        return {count - other.count, bytes - other.bytes};
+    }
+};
+
+// Keeps the draw benchmark about the runtime rather than a backend: calls are
+// counted and otherwise dropped.
+class CountingRenderer : public Renderer
+{
+public:
+    uint64_t drawCount = 0;
+    uint64_t clipCount = 0;
+
+    void save() override {}
+    void restore() override {}
+    void transform(const Mat2D&) override {}
+    void drawPath(RenderPath*, RenderPaint*) override { drawCount++; }
+    void clipPath(RenderPath*) override { clipCount++; }
+    void drawImage(const RenderImage*, BlendMode, float) override { drawCount++; }
+    void drawImageMesh(const RenderImage*,
+                       rcp<RenderBuffer>,
+                       rcp<RenderBuffer>,
+                       rcp<RenderBuffer>,
+                       uint32_t,
+                       uint32_t,
+                       BlendMode,
+                       float) override
+    {
+        drawCount++;
+    }
+};
+
+struct Options
+{
+    std::string assets = "../../test/assets";
+    std::string out;
+    std::string compare;
+    std::string filter;
+    int iterations = 10;
+    int frames = 120;
+    double threshold = 0.10;
+};
+
+struct Result
+{
+    std::string name;
+    double ns = 0;
+    uint64_t allocs = 0;
+    uint64_t bytes = 0;
+    // Renderer calls per frame, only reported by draw.
+    uint64_t drawCalls = 0;
+    uint64_t clips = 0;
+};
+
+using Clock = std::chrono::steady_clock;
+
+double nanoseconds(Clock::duration duration)
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+}
+
+double median(std::vector<double> samples)
+{
+    if (samples.empty())
+    {
+        return 0;
+    }
+    std::sort(samples.begin(), samples.end());
+    size_t middle = samples.size() / 2;
+    return samples.size() % 2 == 1 ? samples[middle]
+                                   : (samples[middle - 1] + samples[middle]) / 2;
+}
+
+std::vector<uint8_t> readFile(const std::filesystem::path& path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(stream),
+                                std::istreambuf_iterator<char>());
+}
+
+// Runs every benchmark for one file, returns false if it couldn't be loaded.
+bool benchmarkFile(const std::string& name,
+                   const std::vector<uint8_t>& bytes,
+                   const Options& options,
+                   std::vector<Result>* results)
+{
+    NoOpFactory factory;
+    Span<const uint8_t> data(bytes.data(), bytes.size());
+    if (File::import(data, &factory) == nullptr)
+    {
+        return false;
+    }
+
+    // The first run of each loop below is a warmup, its time isn't kept but
+    // its allocations are (they're the same on every run).
+    Result import{name + "/import"};
+    std::vector<double> samples;
+    std::unique_ptr<File> file;
+    for (int i = 0; i <= options.iterations; i++)
+    {
+        file = nullptr;
+        Allocations before = Allocations::now();
+        auto start = Clock::now();
+        file = File::import(data, &factory);
+        auto elapsed = Clock::now() - start;
+        Allocations allocated = Allocations::now() - before;
+        if (i == 0)
+        {
+            import.allocs = allocated.count;
+            import.bytes = allocated.bytes;
+            continue;
+        }
+        samples.push_back(nanoseconds(elapsed));
+    }
+    import.ns = median(samples);
+    results->push_back(import);
+
+    Result instance{name + "/instance"};
+    samples.clear();
+    for (int i = 0; i <= options.iterations; i++)
+    {
+        Allocations before = Allocations::now();
+        auto start = Clock::now();
+        auto artboard = file->artboardDefault();
+        auto elapsed = Clock::now() - start;
+        Allocations allocated = Allocations::now() - before;
+        if (i == 0)
+        {
+            instance.allocs = allocated.count;
+            instance.bytes = allocated.bytes;
+            continue;
+        }
+        samples.push_back(nanoseconds(elapsed));
+    }
+    instance.ns = median(samples);
+    results->push_back(instance);
+
+    // Advance and draw alternate like they do in an app, each timed on its
+    // own and reported per frame.
+    Result advance{name + "/advance"};
+    Result draw{name + "/draw"};
+    std::vector<double> drawSamples;
+    samples.clear();
+    const float frameSeconds = 1.0f / 60.0f;
+    for (int i = 0; i <= options.iterations; i++)
+    {
+        auto artboard = file->artboardDefault();
+        if (artboard == nullptr)
+        {
+            break;
+        }
+        auto scene = artboard->defaultScene();
+        CountingRenderer renderer;
+        Clock::duration advanceTime{0};
+        Clock::duration drawTime{0};
+        Allocations advanceAllocations;
+        Allocations drawAllocations;
+        for (int frame = 0; frame < options.frames; frame++)
+        {
+            Allocations before = Allocations::now();
+            auto start = Clock::now();
+            if (scene != nullptr)
+            {
+                scene->advanceAndApply(frameSeconds);
+            }
+            else
+            {
+                artboard->advance(frameSeconds);
+            }
+            auto advanced = Clock::now();
+            Allocations afterAdvance = Allocations::now();
+            if (scene != nullptr)
+            {
+                scene->draw(&renderer);
+            }
+            else
+            {
+                artboard->draw(&renderer);
+            }
+            auto drawn = Clock::now();
+            Allocations afterDraw = Allocations::now();
+
+            advanceTime += advanced - start;
+            drawTime += drawn - advanced;
+            advanceAllocations.count += (afterAdvance - before).count;
+            advanceAllocations.bytes += (afterAdvance - before).bytes;
+            drawAllocations.count += (afterDraw - afterAdvance).count;
+            drawAllocations.bytes += (afterDraw - afterAdvance).bytes;
+        }
+        if (i == 0)
+        {
+            advance.allocs = advanceAllocations.count;
+            advance.bytes = advanceAllocations.bytes;
+            draw.allocs = drawAllocations.count;
+            draw.bytes = drawAllocations.bytes;
+            draw.drawCalls = renderer.drawCount / options.frames;
+            draw.clips = renderer.clipCount / options.frames;
+            continue;
+        }
+        samples.push_back(nanoseconds(advanceTime) / options.frames);
+        drawSamples.push_back(nanoseconds(drawTime) / options.frames);
+    }
+    advance.ns = median(samples);
+    draw.ns = median(drawSamples);
+    results->push_back(advance);
+    results->push_back(draw);
+    return true;
+}
+
+std::string resultJson(const Result& result)
+{
+    std::ostringstream json;
+    json << "{\"name\":\"" << result.name << "\",\"ns\":" << (uint64_t)result.ns
+         << ",\"allocs\":" << result.allocs << ",\"bytes\":" << result.bytes;
+    if (result.drawCalls != 0 || result.clips != 0)
+    {
+        json << ",\"drawCalls\":" << result.drawCalls << ",\"clips\":" << result.clips;
+    }
+    json << "}";
+    return json.str();
+}
+
+void writeJson(std::ostream& stream, const Options& options, const std::vector<Result>& results)
+{
+    stream << "{\n";
+    stream << "\"iterations\":" << options.iterations << ",\n";
+    stream << "\"frames\":" << options.frames << ",\n";
+    stream << "\"results\":[\n";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        stream << resultJson(results[i]) << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    stream << "]\n}\n";
+}
+
+// Pulls "key":<number> out of one result line.
+bool readNumber(const std::string& line, const char* key, double* value)
+{
+    std::string pattern = std::string("\"") + key + "\":";
+    size_t position = line.find(pattern);
+    if (position == std::string::npos)
+    {
+        return false;
+    }
+    *value = std::strtod(line.c_str() + position + pattern.size(), nullptr);
+    return true;
+}
+
+// Reads results back from the JSON this tool writes (one result per line).
+bool readResults(const std::string& path, std::map<std::string, Result>* results)
+{
+    std::ifstream stream(path);
+    if (!stream)
+    {
+        return false;
+    }
+    const std::string namePattern = "\"name\":\"";
+    std::string line;
+    while (std::getline(stream, line))
+    {
+        size_t start = line.find(namePattern);
+        if (start == std::string::npos)
+        {
+            continue;
+        }
+        start += namePattern.size();
+        size_t end = line.find('"', start);
+        if (end == std::string::npos)
+        {
+            continue;
+        }
+        Result result;
+        result.name = line.substr(start, end - start);
+        double allocs = 0, bytes = 0;
+        readNumber(line, "ns", &result.ns);
+        readNumber(line, "allocs", &allocs);
+        readNumber(line, "bytes", &bytes);
+        result.allocs = (uint64_t)allocs;
+        result.bytes = (uint64_t)bytes;
+        (*results)[result.name] = result;
+    }
+    return true;
+}
+
+// Returns the number of regressions found.
+int compareResults(const std::map<std::string, Result>& baseline,
+                   const std::vector<Result>& results,
+                   double threshold)
+{
+    int regressions = 0;
+    for (const Result& result : results)
+    {
+        auto found = baseline.find(result.name);
+        if (found == baseline.end())
+        {
+            continue;
+        }
+        const Result& base = found->second;
+        double change = base.ns > 0 ? result.ns / base.ns - 1.0 : 0.0;
+        bool slower = change > threshold;
+        bool allocates = result.allocs > base.allocs;
+        if (!slower && !allocates)
+        {
+            continue;
+        }
+        regressions++;
+        fprintf(stderr,
+                "REGRESSION %s: %.0fns -> %.0fns (%+.1f%%), allocs %llu -> %llu\n",
+                result.name.c_str(),
+                base.ns,
+                result.ns,
+                change * 100.0,
+                (unsigned long long)base.allocs,
+                (unsigned long long)result.allocs);
+    }
+    return regressions;
+}
+
+void printUsage()
+{
+    fprintf(stderr,
+            "usage: bench [options]\n"
+            "  --assets <dir>       directory of .riv files (default ../../test/assets)\n"
+            "  --filter <text>      only benchmark files whose name contains text\n"
+            "  --iterations <n>     timed runs per metric, the median is kept (default 10)\n"
+            "  --frames <n>         frames advanced and drawn per run (default 120)\n"
+            "  --out <file>         write JSON results to file instead of stdout\n"
+            "  --compare <file>     compare against results from a previous run\n"
+            "  --threshold <ratio>  slowdown reported as a regression (default 0.10)\n");
+}
+
+bool parseOptions(int argc, const char* argv[], Options* options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            return false;
+        }
+        const char* value = argv[++i];
+        if (arg == "--assets")
+        {
+            options->assets = value;
+        }
+        else if (arg == "--filter")
+        {
+            options->filter = value;
+        }
+        else if (arg == "--iterations")
+        {
+            options->iterations = std::max(1, atoi(value));
+        }
+        else if (arg == "--frames")
+        {
+            options->frames = std::max(1, atoi(value));
+        }
+        else if (arg == "--out")
+        {
+            options->out = value;
+        }
+        else if (arg == "--compare")
+        {
+            options->compare = value;
+        }
+        else if (arg == "--threshold")
+        {
+            options->threshold = atof(value);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    Options options;
+    if (!parseOptions(argc, argv, &options))
+    {
+        printUsage();
+        return 2;
+    }
+
+    std::error_code error;
+    std::vector<std::filesystem::path> paths;
+    for (const auto& entry : std::filesystem::directory_iterator(options.assets, error))
+    {
+        const auto& path = entry.path();
+        if (path.extension() == ".riv" &&
+            path.filename().string().find(options.filter) != std::string::npos)
+        {
+            paths.push_back(path);
+        }
+    }
+    if (error)
+    {
+        fprintf(stderr, "couldn't read %s: %s\n", options.assets.c_str(), error.message().c_str());
+        return 2;
+    }
+    // Sorted so runs line up when diffed.
+    std::sort(paths.begin(), paths.end());
+
+    std::vector<Result> results;
+    for (const auto& path : paths)
+    {
+        std::string name = path.stem().string();
+        if (!benchmarkFile(name, readFile(path), options, &results))
+        {
+            fprintf(stderr, "skipped %s, failed to import\n", name.c_str());
+        }
+    }
+
+    if (options.out.empty())
+    {
+        std::ostringstream json;
+        writeJson(json, options, results);
+        fputs(json.str().c_str(), stdout);
+    }
+    else
+    {
+        std::ofstream stream(options.out);
+        writeJson(stream, options, results);
+    }
+
+    if (!options.compare.empty())
+    {
+        std::map<std::string, Result> baseline;
+        if (!readResults(options.compare, &baseline))
+        {
+            fprintf(stderr, "couldn't read %s\n", options.compare.c_str());
+            return 2;
+        }
+        int regressions = compareResults(baseline, results, options.threshold);
+        fprintf(stderr, "%d regression(s) against %s\n", regressions, options.compare.c_str());
+        return regressions == 0 ? 0 : 1;
+    }
+    return 0;
+}
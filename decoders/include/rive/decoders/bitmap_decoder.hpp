@@ -5,6 +5,9 @@
 #ifndef _RIVE_BITMAP_DECODER_HPP_
 #define _RIVE_BITMAP_DECODER_HPP_
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
 
 /// Bitmap will always take ownership of the bytes it is constructed with.
@@ -14,9 +17,27 @@ public:
     enum class PixelFormat : uint8_t
     {
         RGB,
-        RGBA
+        RGBA,
+        // RGBA with the color channels already multiplied by alpha.
+        RGBAPremul,
     };
 
+    struct DecodeOptions
+    {
+        /// When non-zero, images wider or taller than this are scaled down
+        /// (preserving their aspect ratio) while decoding, never up.
+        uint32_t maxDimension = 0;
+        /// When set, pixels are converted to pixelFormat while decoding
+        /// instead of being left in the image's own format (RGB or RGBA).
+        bool hasPixelFormat = false;
+        PixelFormat pixelFormat = PixelFormat::RGBA;
+    };
+
+    /// Called once the decoded dimensions are known. Returns where to write
+    /// the tightly packed width * height pixels, or null to abort decoding.
+    using PixelAllocator =
+        std::function<uint8_t*(uint32_t width, uint32_t height, PixelFormat format)>;
+
     Bitmap(uint32_t width,
            uint32_t height,
            PixelFormat pixelFormat,
@@ -38,9 +59,36 @@ public:
     std::unique_ptr<const uint8_t[]> detachBytes() { return std::move(m_Bytes); }
     size_t byteSize() const;
     size_t byteSize(PixelFormat format) const;
-    size_t bytesPerPixel(PixelFormat format) const;
+    static size_t bytesPerPixel(PixelFormat format);
 
     static std::unique_ptr<Bitmap> decode(const uint8_t bytes[], size_t byteCount);
+    static std::unique_ptr<Bitmap> decode(const uint8_t bytes[],
+                                          size_t byteCount,
+                                          const DecodeOptions& options);
+
+    /// Decodes into memory provided by allocate, without an intermediate full
+    /// resolution copy. Returns false if the image couldn't be decoded (or
+    /// allocate returned null).
+    static bool decode(const uint8_t bytes[],
+                       size_t byteCount,
+                       const DecodeOptions& options,
+                       const PixelAllocator& allocate);
+
+    /// Reads the dimensions and natural pixel format (RGB or RGBA) of an
+    /// encoded image from its header, without decoding it.
+    static bool probe(const uint8_t bytes[],
+                      size_t byteCount,
+                      uint32_t* width,
+                      uint32_t* height,
+                      PixelFormat* pixelFormat);
+
+    /// Size an image of width x height decodes to when limited to
+    /// maxDimension (0 for no limit).
+    static void scaledSize(uint32_t width,
+                           uint32_t height,
+                           uint32_t maxDimension,
+                           uint32_t* scaledWidth,
+                           uint32_t* scaledHeight);
 
     // Change the pixel format (note this will resize bytes).
     void pixelFormat(PixelFormat format);
@@ -4,6 +4,8 @@
 
 #include "rive/decoders/bitmap_decoder.hpp"
 #include "rive/rive_types.hpp"
+#include "rive/assets/image_header.hpp"
+#include "decode_sink.hpp"
 #include <stdio.h>
 #include <string.h>
 #include <vector>
@@ -19,13 +21,14 @@ Bitmap::Bitmap(uint32_t width, uint32_t height, PixelFormat pixelFormat, const u
     Bitmap(width, height, pixelFormat, std::unique_ptr<const uint8_t[]>(bytes))
 {}
 
-size_t Bitmap::bytesPerPixel(PixelFormat format) const
+size_t Bitmap::bytesPerPixel(PixelFormat format)
 {
     switch (format)
     {
         case PixelFormat::RGB:
             return 3;
         case PixelFormat::RGBA:
+        case PixelFormat::RGBAPremul:
             return 4;
     }
     RIVE_UNREACHABLE();
@@ -38,11 +41,11 @@ size_t Bitmap::byteSize(PixelFormat format) const
 
 size_t Bitmap::byteSize() const { return byteSize(m_PixelFormat); }
 
-std::unique_ptr<Bitmap> DecodePng(const uint8_t bytes[], size_t byteCount);
-std::unique_ptr<Bitmap> DecodeJpeg(const uint8_t bytes[], size_t byteCount);
-std::unique_ptr<Bitmap> DecodeWebP(const uint8_t bytes[], size_t byteCount) { return nullptr; }
+bool DecodePng(const uint8_t bytes[], size_t byteCount, DecodeSink& sink);
+bool DecodeJpeg(const uint8_t bytes[], size_t byteCount, DecodeSink& sink);
+bool DecodeWebP(const uint8_t bytes[], size_t byteCount, DecodeSink& sink) { return false; }
 
-using BitmapDecoder = std::unique_ptr<Bitmap> (*)(const uint8_t bytes[], size_t byteCount);
+using BitmapDecoder = bool (*)(const uint8_t bytes[], size_t byteCount, DecodeSink& sink);
 struct ImageFormat
 {
     const char* name;
@@ -50,7 +53,66 @@ struct ImageFormat
     BitmapDecoder decodeImage;
 };
 
+void Bitmap::scaledSize(uint32_t width,
+                        uint32_t height,
+                        uint32_t maxDimension,
+                        uint32_t* scaledWidth,
+                        uint32_t* scaledHeight)
+{
+    rive::ImageHeader::scaledSize(width, height, maxDimension, scaledWidth, scaledHeight);
+}
+
+bool Bitmap::probe(const uint8_t bytes[],
+                   size_t byteCount,
+                   uint32_t* width,
+                   uint32_t* height,
+                   PixelFormat* pixelFormat)
+{
+    rive::ImageHeader header;
+    if (!rive::ImageHeader::probe(rive::Span<const uint8_t>(bytes, byteCount), &header))
+    {
+        return false;
+    }
+    *width = header.width;
+    *height = header.height;
+    *pixelFormat = header.hasAlpha ? PixelFormat::RGBA : PixelFormat::RGB;
+    return true;
+}
+
 std::unique_ptr<Bitmap> Bitmap::decode(const uint8_t bytes[], size_t byteCount)
+{
+    return decode(bytes, byteCount, DecodeOptions());
+}
+
+std::unique_ptr<Bitmap> Bitmap::decode(const uint8_t bytes[],
+                                       size_t byteCount,
+                                       const DecodeOptions& options)
+{
+    std::unique_ptr<uint8_t[]> pixels;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    PixelFormat pixelFormat = PixelFormat::RGB;
+    auto allocate = [&](uint32_t w, uint32_t h, PixelFormat format) {
+        width = w;
+        height = h;
+        pixelFormat = format;
+        pixels.reset(new uint8_t[(size_t)w * h * bytesPerPixel(format)]);
+        return pixels.get();
+    };
+    if (!decode(bytes, byteCount, options, allocate))
+    {
+        return nullptr;
+    }
+    return std::make_unique<Bitmap>(width,
+                                    height,
+                                    pixelFormat,
+                                    std::unique_ptr<const uint8_t[]>(std::move(pixels)));
+}
+
+bool Bitmap::decode(const uint8_t bytes[],
+                    size_t byteCount,
+                    const DecodeOptions& options,
+                    const PixelAllocator& allocate)
 {
     static ImageFormat decoders[] = {
         {
@@ -88,14 +150,15 @@ std::unique_ptr<Bitmap> Bitmap::decode(const uint8_t bytes[], size_t byteCount)
             continue;
         }
 
-        auto bitmap = recognizer.decodeImage(bytes, byteCount);
-        if (!bitmap)
+        DecodeSink sink(options, allocate);
+        if (!recognizer.decodeImage(bytes, byteCount, sink) || !sink.finished())
         {
             fprintf(stderr, "Bitmap::decode - failed to decode a %s.\n", recognizer.name);
+            return false;
         }
-        return bitmap;
+        return true;
     }
-    return nullptr;
+    return false;
 }
 
 void Bitmap::pixelFormat(PixelFormat format)
@@ -107,16 +170,15 @@ void Bitmap::pixelFormat(PixelFormat format)
     auto nextByteSize = byteSize(format);
     auto nextBytes = std::unique_ptr<uint8_t[]>(new uint8_t[nextByteSize]);
 
-    size_t fromBytesPerPixel = bytesPerPixel(m_PixelFormat);
-    size_t toBytesPerPixel = bytesPerPixel(format);
-    int writeIndex = 0;
-    int readIndex = 0;
-    for (uint32_t i = 0; i < m_Width * m_Height; i++)
+    size_t fromRowBytes = m_Width * bytesPerPixel(m_PixelFormat);
+    size_t toRowBytes = m_Width * bytesPerPixel(format);
+    for (uint32_t row = 0; row < m_Height; row++)
     {
-        for (size_t j = 0; j < toBytesPerPixel; j++)
-        {
-            nextBytes[writeIndex++] = j < fromBytesPerPixel ? m_Bytes[readIndex++] : 255;
-        }
+        ConvertPixelRow(m_Bytes.get() + row * fromRowBytes,
+                        m_PixelFormat,
+                        nextBytes.get() + row * toRowBytes,
+                        format,
+                        m_Width);
     }
 
     m_Bytes = std::move(nextBytes);
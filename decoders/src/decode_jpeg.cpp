@@ -1,6 +1,7 @@
 // Adapted from libjpeg-turbo's example:
 // https://github.com/libjpeg-turbo/libjpeg-turbo/blob/main/example.c
 #include "rive/decoders/bitmap_decoder.hpp"
+#include "decode_sink.hpp"
 
 #include "jpeglib.h"
 #include "jerror.h"
@@ -31,14 +32,12 @@ void my_error_exit(j_common_ptr cinfo)
     longjmp(myerr->setjmp_buffer, 1);
 }
 
-std::unique_ptr<Bitmap> DecodeJpeg(const uint8_t bytes[], size_t byteCount)
+bool DecodeJpeg(const uint8_t bytes[], size_t byteCount, DecodeSink& sink)
 {
     struct jpeg_decompress_struct cinfo;
     struct my_error_mgr jerr;
 
     JSAMPARRAY buffer = nullptr;
-    std::unique_ptr<const uint8_t[]> pixelBuffer;
-    int row_stride;
 
     // Step 1: allocate and initialize JPEG decompression object.
 
@@ -51,7 +50,7 @@ std::unique_ptr<Bitmap> DecodeJpeg(const uint8_t bytes[], size_t byteCount)
         // If we get here, the JPEG code has signaled an error.
         // We need to clean up the JPEG object, close the input file, and return.
         jpeg_destroy_decompress(&cinfo);
-        return nullptr;
+        return false;
     }
 
     // Now we can initialize the JPEG decompression object.
@@ -70,6 +69,26 @@ std::unique_ptr<Bitmap> DecodeJpeg(const uint8_t bytes[], size_t byteCount)
     cinfo.data_precision = 8;
     cinfo.out_color_space = JCS_RGB;
 
+    // Let the IDCT do as much of the downscaling as it can (1/2, 1/4 or 1/8)
+    // while staying at least as large as the requested size, the sink box
+    // filters the rest.
+    uint32_t outputWidth, outputHeight;
+    Bitmap::scaledSize(cinfo.image_width,
+                       cinfo.image_height,
+                       sink.maxDimension(),
+                       &outputWidth,
+                       &outputHeight);
+    for (unsigned int denom = 8; denom > 1; denom /= 2)
+    {
+        if ((cinfo.image_width + denom - 1) / denom >= outputWidth &&
+            (cinfo.image_height + denom - 1) / denom >= outputHeight)
+        {
+            cinfo.scale_num = 1;
+            cinfo.scale_denom = denom;
+            break;
+        }
+    }
+
     // Step 5: Start decompressor
     jpeg_start_decompress(&cinfo);
 
@@ -77,31 +96,28 @@ std::unique_ptr<Bitmap> DecodeJpeg(const uint8_t bytes[], size_t byteCount)
     assert(cinfo.data_precision == 8);
     assert(cinfo.output_components == 3);
 
-    pixelBuffer = std::make_unique<uint8_t[]>(cinfo.output_width * cinfo.output_height *
-                                              cinfo.output_components);
-
-    uint8_t* pixelWriteBuffer = (uint8_t*)pixelBuffer.get();
-
-    // Samples per row in output buffer
-    row_stride = cinfo.output_width * cinfo.output_components;
-    // Make a one-row-high sample array that will go away when done with image
-    buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE, row_stride, 1);
+    if (!sink.begin(cinfo.output_width,
+                    cinfo.output_height,
+                    Bitmap::PixelFormat::RGB,
+                    std::min<uint32_t>(outputWidth, cinfo.output_width),
+                    std::min<uint32_t>(outputHeight, cinfo.output_height)))
+    {
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
 
     // Step 6: while (scan lines remain to be read)
     //           jpeg_read_scanlines(...);
 
     // Here we use the library's state variable cinfo->output_scanline as the
-    // loop counter, so that we don't have to keep track ourselves.
-    //
+    // loop counter, so that we don't have to keep track ourselves. Rows are
+    // decoded straight into the sink.
     while (cinfo.output_scanline < cinfo.output_height)
     {
-        // jpeg_read_scanlines expects an array of pointers to scanlines.
-        // Here the array is only one element long, but you could ask for
-        // more than one scanline at a time if that's more convenient.
+        JSAMPROW row = sink.nextRow();
+        buffer = &row;
         jpeg_read_scanlines(&cinfo, buffer, 1);
-
-        memcpy(pixelWriteBuffer, buffer[0], row_stride);
-        pixelWriteBuffer += row_stride;
+        sink.commitRow();
     }
 
     // Step 7: Finish decompression
@@ -110,8 +126,5 @@ std::unique_ptr<Bitmap> DecodeJpeg(const uint8_t bytes[], size_t byteCount)
     // Step 8: Release JPEG decompression object
     jpeg_destroy_decompress(&cinfo);
 
-    return std::make_unique<Bitmap>(cinfo.output_width,
-                                    cinfo.output_height,
-                                    Bitmap::PixelFormat::RGB,
-                                    std::move(pixelBuffer));
-}
\ No newline at end of file
+    return true;
+}
@@ -3,6 +3,7 @@
  */
 
 #include "rive/decoders/bitmap_decoder.hpp"
+#include "decode_sink.hpp"
 #include "png.h"
 #include <algorithm>
 #include <cassert>
@@ -34,7 +35,7 @@ static void ReadDataFromMemory(png_structp png_ptr, png_bytep outBytes, png_size
     }
 }
 
-std::unique_ptr<Bitmap> DecodePng(const uint8_t bytes[], size_t byteCount)
+bool DecodePng(const uint8_t bytes[], size_t byteCount, DecodeSink& sink)
 {
     png_structp png_ptr;
     png_infop info_ptr;
@@ -46,7 +47,7 @@ std::unique_ptr<Bitmap> DecodePng(const uint8_t bytes[], size_t byteCount)
     if (png_ptr == nullptr)
     {
         printf("DecodePng - libpng failed (png_create_read_struct).");
-        return nullptr;
+        return false;
     }
 
     info_ptr = png_create_info_struct(png_ptr);
@@ -54,7 +55,7 @@ std::unique_ptr<Bitmap> DecodePng(const uint8_t bytes[], size_t byteCount)
     {
         png_destroy_read_struct(&png_ptr, (png_infopp)NULL, (png_infopp)NULL);
         printf("DecodePng - libpng failed (png_create_info_struct).");
-        return nullptr;
+        return false;
     }
 
     EncodedImageBuffer stream = {bytes, 0, byteCount};
@@ -101,32 +102,48 @@ std::unique_ptr<Bitmap> DecodePng(const uint8_t bytes[], size_t byteCount)
     png_read_update_info(png_ptr, info_ptr);
     uint8_t channels = png_get_channels(png_ptr, info_ptr);
 
-    auto pixelBuffer = new uint8_t[width * height * channels];
+    assert(channels == 3 || channels == 4);
+    Bitmap::PixelFormat pixelFormat =
+        channels == 4 ? Bitmap::PixelFormat::RGBA : Bitmap::PixelFormat::RGB;
 
-    png_bytep* row_pointers = new png_bytep[height];
+    uint32_t outputWidth, outputHeight;
+    Bitmap::scaledSize(width, height, sink.maxDimension(), &outputWidth, &outputHeight);
+    if (!sink.begin(width, height, pixelFormat, outputWidth, outputHeight))
+    {
+        png_destroy_read_struct(&png_ptr, &info_ptr, (png_infopp) nullptr);
+        return false;
+    }
 
-    for (unsigned row = 0; row < height; row++)
+    if (interlace_type == PNG_INTERLACE_NONE)
+    {
+        // Stream rows straight into the sink, the full resolution image is
+        // never held in memory.
+        for (png_uint_32 row = 0; row < height; row++)
+        {
+            png_read_row(png_ptr, sink.nextRow(), nullptr);
+            sink.commitRow();
+        }
+    }
+    else
     {
-        unsigned int rIndex = row;
-        row_pointers[rIndex] = pixelBuffer + (row * (width * channels));
+        // Interlaced rows aren't final until the last pass.
+        size_t rowBytes = width * channels;
+        std::unique_ptr<uint8_t[]> pixelBuffer(new uint8_t[rowBytes * height]);
+        std::unique_ptr<png_bytep[]> row_pointers(new png_bytep[height]);
+        for (png_uint_32 row = 0; row < height; row++)
+        {
+            row_pointers[row] = pixelBuffer.get() + row * rowBytes;
+        }
+        png_read_image(png_ptr, row_pointers.get());
+        for (png_uint_32 row = 0; row < height; row++)
+        {
+            memcpy(sink.nextRow(), row_pointers[row], rowBytes);
+            sink.commitRow();
+        }
     }
-    png_read_image(png_ptr, row_pointers);
     png_read_end(png_ptr, info_ptr);
 
     png_destroy_read_struct(&png_ptr, &info_ptr, (png_infopp) nullptr);
 
-    delete[] row_pointers;
-
-    Bitmap::PixelFormat pixelFormat;
-    assert(channels == 3 || channels == 4);
-    switch (channels)
-    {
-        case 4:
-            pixelFormat = Bitmap::PixelFormat::RGBA;
-            break;
-        case 3:
-            pixelFormat = Bitmap::PixelFormat::RGB;
-            break;
-    }
-    return std::make_unique<Bitmap>(width, height, pixelFormat, pixelBuffer);
+    return true;
 }
@@ -0,0 +1,211 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "decode_sink.hpp"
+#include "rive/math/simd.hpp"
+
+#include <algorithm>
+#include <string.h>
+
+using namespace rive;
+
+static void premultiplyRow(const uint8_t* src, uint8_t* dst, uint32_t width)
+{
+    for (uint32_t i = 0; i < width; i++, src += 4, dst += 4)
+    {
+        auto pixel = simd::cast<uint16_t>(simd::load<uint8_t, 4>(src));
+        uint16_t alpha = pixel[3];
+        simd::gvec<uint16_t, 4> scale = {alpha, alpha, alpha, 255};
+        // Rounded division by 255.
+        auto product = pixel * scale + uint16_t(128);
+        product = (product + (product >> uint16_t(8))) >> uint16_t(8);
+        simd::store(dst, simd::cast<uint8_t>(product));
+    }
+}
+
+static void unpremultiplyRow(const uint8_t* src, uint8_t* dst, uint32_t width)
+{
+    for (uint32_t i = 0; i < width; i++, src += 4, dst += 4)
+    {
+        uint32_t alpha = src[3];
+        for (int c = 0; c < 3; c++)
+        {
+            dst[c] = alpha == 0 ? 0 : (uint8_t)std::min(255u, (src[c] * 255u + alpha / 2) / alpha);
+        }
+        dst[3] = (uint8_t)alpha;
+    }
+}
+
+void ConvertPixelRow(const uint8_t* src,
+                     Bitmap::PixelFormat srcFormat,
+                     uint8_t* dst,
+                     Bitmap::PixelFormat dstFormat,
+                     uint32_t width)
+{
+    using PixelFormat = Bitmap::PixelFormat;
+    if (srcFormat == dstFormat)
+    {
+        if (src != dst)
+        {
+            memcpy(dst, src, width * Bitmap::bytesPerPixel(srcFormat));
+        }
+        return;
+    }
+    if (srcFormat == PixelFormat::RGB)
+    {
+        // Opaque pixels are the same premultiplied or not.
+        for (uint32_t i = 0; i < width; i++, src += 3, dst += 4)
+        {
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+            dst[3] = 255;
+        }
+        return;
+    }
+    if (dstFormat == PixelFormat::RGBAPremul)
+    {
+        premultiplyRow(src, dst, width);
+        return;
+    }
+    if (srcFormat == PixelFormat::RGBAPremul)
+    {
+        unpremultiplyRow(src, dst, width);
+        if (dstFormat == PixelFormat::RGBA)
+        {
+            return;
+        }
+        src = dst;
+    }
+    // Drop alpha, moving forward so this also works in place.
+    for (uint32_t i = 0; i < width; i++, src += 4, dst += 3)
+    {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+    }
+}
+
+DecodeSink::DecodeSink(const Bitmap::DecodeOptions& options,
+                       const Bitmap::PixelAllocator& allocate) :
+    m_options(options), m_allocate(allocate)
+{}
+
+bool DecodeSink::begin(uint32_t width,
+                       uint32_t height,
+                       Bitmap::PixelFormat format,
+                       uint32_t outputWidth,
+                       uint32_t outputHeight)
+{
+    m_width = width;
+    m_height = height;
+    m_format = format;
+    m_outputWidth = outputWidth;
+    m_outputHeight = outputHeight;
+    m_outputFormat = m_options.hasPixelFormat ? m_options.pixelFormat : format;
+    m_pixels = m_allocate(m_outputWidth, m_outputHeight, m_outputFormat);
+    if (m_pixels == nullptr)
+    {
+        return false;
+    }
+
+    bool scaling = m_outputWidth != m_width || m_outputHeight != m_height;
+    if (scaling || m_format != m_outputFormat)
+    {
+        m_row.resize(m_width * Bitmap::bytesPerPixel(m_format));
+    }
+    if (scaling)
+    {
+        m_filterFormat = m_format == Bitmap::PixelFormat::RGB ? Bitmap::PixelFormat::RGB
+                                                              : Bitmap::PixelFormat::RGBAPremul;
+        size_t channels = Bitmap::bytesPerPixel(m_filterFormat);
+        m_filterRow.resize(m_width * channels);
+        m_columnMap.resize(m_width);
+        m_columnCounts.assign(m_outputWidth, 0);
+        for (uint32_t x = 0; x < m_width; x++)
+        {
+            m_columnMap[x] = (uint32_t)((uint64_t)x * m_outputWidth / m_width);
+            m_columnCounts[m_columnMap[x]]++;
+        }
+        m_accumulation.assign(m_outputWidth * channels, 0);
+    }
+    return true;
+}
+
+uint8_t* DecodeSink::nextRow()
+{
+    if (m_row.empty())
+    {
+        return m_pixels + (size_t)m_sourceRow * m_outputWidth * Bitmap::bytesPerPixel(m_format);
+    }
+    return m_row.data();
+}
+
+void DecodeSink::commitRow()
+{
+    if (m_sourceRow >= m_height)
+    {
+        return;
+    }
+    if (m_accumulation.empty())
+    {
+        // Same size, the row only needs converting (if at all).
+        if (!m_row.empty())
+        {
+            size_t rowBytes = m_outputWidth * Bitmap::bytesPerPixel(m_outputFormat);
+            ConvertPixelRow(m_row.data(),
+                            m_format,
+                            m_pixels + m_sourceRow * rowBytes,
+                            m_outputFormat,
+                            m_width);
+        }
+        m_sourceRow++;
+        m_outputRow++;
+        return;
+    }
+
+    ConvertPixelRow(m_row.data(), m_format, m_filterRow.data(), m_filterFormat, m_width);
+    size_t channels = Bitmap::bytesPerPixel(m_filterFormat);
+    const uint8_t* pixel = m_filterRow.data();
+    for (uint32_t x = 0; x < m_width; x++, pixel += channels)
+    {
+        uint32_t* sum = &m_accumulation[m_columnMap[x] * channels];
+        for (size_t c = 0; c < channels; c++)
+        {
+            sum[c] += pixel[c];
+        }
+    }
+    m_accumulatedRows++;
+    m_sourceRow++;
+
+    uint32_t nextOutputRow = (uint32_t)((uint64_t)m_sourceRow * m_outputHeight / m_height);
+    if (m_sourceRow == m_height || nextOutputRow != m_outputRow)
+    {
+        emitAccumulatedRow();
+    }
+}
+
+void DecodeSink::emitAccumulatedRow()
+{
+    size_t channels = Bitmap::bytesPerPixel(m_filterFormat);
+    uint8_t* averaged = m_filterRow.data();
+    for (uint32_t x = 0; x < m_outputWidth; x++)
+    {
+        uint32_t divisor = m_columnCounts[x] * m_accumulatedRows;
+        for (size_t c = 0; c < channels; c++)
+        {
+            uint32_t& sum = m_accumulation[x * channels + c];
+            averaged[x * channels + c] = (uint8_t)((sum + divisor / 2) / divisor);
+            sum = 0;
+        }
+    }
+    size_t rowBytes = m_outputWidth * Bitmap::bytesPerPixel(m_outputFormat);
+    ConvertPixelRow(averaged,
+                    m_filterFormat,
+                    m_pixels + m_outputRow * rowBytes,
+                    m_outputFormat,
+                    m_outputWidth);
+    m_accumulatedRows = 0;
+    m_outputRow++;
+}
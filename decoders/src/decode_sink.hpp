@@ -0,0 +1,75 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#ifndef _RIVE_DECODE_SINK_HPP_
+#define _RIVE_DECODE_SINK_HPP_
+
+#include "rive/decoders/bitmap_decoder.hpp"
+
+#include <vector>
+
+// Converts width pixels from one format to another. src and dst may be the
+// same row when both formats have the same number of bytes per pixel.
+void ConvertPixelRow(const uint8_t* src,
+                     Bitmap::PixelFormat srcFormat,
+                     uint8_t* dst,
+                     Bitmap::PixelFormat dstFormat,
+                     uint32_t width);
+
+// Receives decoded rows top to bottom and writes them to the caller's pixels,
+// converting the format and box filtering down to the requested size on the
+// fly so the full resolution image never has to be held in memory.
+class DecodeSink
+{
+public:
+    DecodeSink(const Bitmap::DecodeOptions& options, const Bitmap::PixelAllocator& allocate);
+
+    uint32_t maxDimension() const { return m_options.maxDimension; }
+
+    // Sets up decoding of a width x height image in format into
+    // outputWidth x outputHeight pixels. Returns false if the allocator
+    // refused.
+    bool begin(uint32_t width,
+               uint32_t height,
+               Bitmap::PixelFormat format,
+               uint32_t outputWidth,
+               uint32_t outputHeight);
+
+    // Where the decoder should write the next row, this is the destination
+    // itself when no conversion is needed.
+    uint8_t* nextRow();
+    // Consumes the row most recently returned by nextRow().
+    void commitRow();
+
+    // True once every output row has been written.
+    bool finished() const { return m_outputRow == m_outputHeight; }
+
+private:
+    void emitAccumulatedRow();
+
+    const Bitmap::DecodeOptions& m_options;
+    const Bitmap::PixelAllocator& m_allocate;
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+    Bitmap::PixelFormat m_format = Bitmap::PixelFormat::RGB;
+    uint32_t m_outputWidth = 0;
+    uint32_t m_outputHeight = 0;
+    Bitmap::PixelFormat m_outputFormat = Bitmap::PixelFormat::RGB;
+    // Format rows are averaged in, alpha is premultiplied so transparent
+    // pixels don't bleed their color.
+    Bitmap::PixelFormat m_filterFormat = Bitmap::PixelFormat::RGB;
+    uint8_t* m_pixels = nullptr;
+    uint32_t m_sourceRow = 0;
+    uint32_t m_outputRow = 0;
+
+    std::vector<uint8_t> m_row;
+    std::vector<uint8_t> m_filterRow;
+    // Box filter state, only used when scaling.
+    std::vector<uint32_t> m_columnMap;
+    std::vector<uint32_t> m_columnCounts;
+    std::vector<uint32_t> m_accumulation;
+    uint32_t m_accumulatedRows = 0;
+};
+
+#endif
@@ -0,0 +1,57 @@
+#!/bin/bash
+set -e
+
+# Builds the benchmarks in their own (release by default) workspace and runs
+# them, passing along any arguments after "--", e.g.:
+#   ./bench.sh -- --out baseline.json
+
+unameOut="$(uname -s)"
+case "${unameOut}" in
+Linux*) machine=linux ;;
+Darwin*) machine=macosx ;;
+*) machine="unhandled:${unameOut}" ;;
+esac
+
+CONFIG=release
+BENCH_ARGS=()
+
+while [[ $# -gt 0 ]]; do
+  if [[ $1 = "debug" ]]; then
+    CONFIG=debug
+  elif [[ $1 = "--" ]]; then
+    shift
+    BENCH_ARGS=("$@")
+    break
+  fi
+  shift
+done
+
+if [[ -z "$PREMAKE" ]]; then
+  if [[ ! -f "dependencies/bin/premake5" ]]; then
+    echo "premake5 not found, run ./test.sh once to fetch it (or set PREMAKE)"
+    exit 1
+  fi
+  export PREMAKE=$PWD/dependencies/bin/premake5
+fi
+
+pushd ../
+RUNTIME=$PWD
+popd
+
+export PREMAKE_PATH="$RUNTIME/dependencies/export-compile-commands":"$RUNTIME/build":"$PREMAKE_PATH"
+PREMAKE_COMMANDS="--with_rive_text --with_rive_audio=external --config=$CONFIG"
+
+pushd bench
+OUT_DIR="out/$CONFIG"
+mkdir -p $OUT_DIR
+$PREMAKE gmake2 $PREMAKE_COMMANDS --out=$OUT_DIR
+pushd $OUT_DIR
+if [[ $machine = "macosx" ]]; then
+  make -j$(($(sysctl -n hw.physicalcpu) + 1))
+else
+  make -j$(nproc)
+fi
+popd
+# Paths to the assets are relative to dev/bench, like the tests'.
+$OUT_DIR/bench "${BENCH_ARGS[@]}"
+popd
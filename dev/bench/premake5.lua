@@ -0,0 +1,50 @@
+-- Benchmarks build the runtime the way it ships: release by default, and
+-- without the testing, tools or tracing defines the tests turn on. Features
+-- come from the usual options (see bench.sh).
+if not _OPTIONS['config'] and not _OPTIONS['release'] then
+    _OPTIONS['config'] = 'release'
+end
+
+dofile('rive_build_config.lua')
+
+dofile(path.join(path.getabsolute('../../'), 'premake5_v2.lua'))
+dofile(path.join(path.getabsolute('../../decoders/'), 'premake5_v2.lua'))
+
+project('bench')
+do
+    kind('ConsoleApp')
+    exceptionhandling('On')
+
+    includedirs({
+        '../../include',
+        '../../decoders/include',
+        miniaudio,
+    })
+
+    links({
+        'rive',
+        'rive_harfbuzz',
+        'rive_sheenbidi',
+        'rive_decoders',
+        'libpng',
+        'zlib',
+        'libjpeg',
+    })
+
+    files({
+        '../../bench/**.cpp', -- the benchmarks
+        '../../utils/**.cpp', -- no_op utils
+    })
+
+    filter('system:linux')
+    do
+        links({ 'dl', 'pthread' })
+    end
+    filter({ 'options:not no-harfbuzz-renames' })
+    do
+        includedirs({
+            dependencies,
+        })
+        forceincludes({ 'rive_harfbuzz_renames.h' })
+    end
+end
@@ -464,6 +464,28 @@ class Definition {
     }
     ctxCode.writeln('} return nullptr; }');
 
+    ctxCode.writeln('static size_t objectSize(int typeKey) {'
+        'switch(typeKey) {');
+    for (final definition in runtimeDefinitions) {
+      if (definition._isAbstract) {
+        continue;
+      }
+      ctxCode.writeln('case ${definition.name}Base::typeKey:');
+      ctxCode.writeln('return sizeof(${definition.name});');
+    }
+    ctxCode.writeln('} return 0; }');
+
+    ctxCode.writeln('static const char* objectName(int typeKey) {'
+        'switch(typeKey) {');
+    for (final definition in runtimeDefinitions) {
+      if (definition._isAbstract) {
+        continue;
+      }
+      ctxCode.writeln('case ${definition.name}Base::typeKey:');
+      ctxCode.writeln('return "${definition.name}";');
+    }
+    ctxCode.writeln('} return nullptr; }');
+
     var usedFieldTypes = <FieldType, List<Property>>{};
     var getSetFieldTypes = <FieldType, List<Property>>{};
     for (final definition in runtimeDefinitions) {
@@ -14,6 +14,9 @@ CONFIG=debug
 for var in "$@"; do
   if [[ $var = "release" ]]; then
     CONFIG=release
+  elif [[ $var = "trace" ]]; then
+    echo Will compile in trace markers...
+    TRACE=true
   elif [ "$var" = "memory" ]; then
     echo Will perform memory checks...
     UTILITY='leaks --atExit --'
@@ -76,9 +79,17 @@ popd
 
 export PREMAKE_PATH="$RUNTIME/dependencies/export-compile-commands":"$RUNTIME/build":"$PREMAKE_PATH"
 PREMAKE_COMMANDS="--with_rive_text --with_rive_audio=external --config=$CONFIG"
+if [[ $TRACE = true ]]; then
+  # A separate build, so the regular tests run without the markers.
+  PREMAKE_COMMANDS="$PREMAKE_COMMANDS --with_rive_tracing"
+fi
 
 out_dir() {
-  echo "out/$CONFIG"
+  if [[ $TRACE = true ]]; then
+    echo "out/${CONFIG}_trace"
+  else
+    echo "out/$CONFIG"
+  fi
 }
 if [[ $machine = "macosx" ]]; then
   OUT_DIR="$(out_dir)"
@@ -21,6 +21,7 @@ do
         './include',
         '../../include',
         '../../decoders/include',
+        '../../software_renderer/include',
         miniaudio,
     })
 
@@ -37,6 +38,7 @@ do
     files({
         '../../test/**.cpp', -- the tests
         '../../utils/**.cpp', -- no_op utils
+        '../../software_renderer/src/**.cpp', -- headless CPU renderer
     })
 
     filter('system:linux')
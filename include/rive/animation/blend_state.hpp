@@ -20,6 +20,7 @@ private:
 
 public:
     ~BlendState() override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
     inline const std::vector<BlendAnimation*>& animations() const { return m_Animations; }
 
 #ifdef TESTING
@@ -13,6 +13,8 @@ public:
     KeyedObject();
     ~KeyedObject() override;
     void addKeyedProperty(std::unique_ptr<KeyedProperty>);
+    /// Number of keyframes across all of this object's keyed properties.
+    size_t keyFrameCount() const;
 
     StatusCode onAddedDirty(CoreContext* context) override;
     StatusCode onAddedClean(CoreContext* context) override;
@@ -23,6 +25,7 @@ public:
     void apply(Artboard* coreContext, float time, float mix);
 
     StatusCode import(ImportStack& importStack) override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
 
 private:
     std::vector<std::unique_ptr<KeyedProperty>> m_keyedProperties;
@@ -12,6 +12,7 @@ public:
     KeyedProperty();
     ~KeyedProperty() override;
     void addKeyFrame(std::unique_ptr<KeyFrame>);
+    size_t keyFrameCount() const { return m_keyFrames.size(); }
     StatusCode onAddedClean(CoreContext* context) override;
     StatusCode onAddedDirty(CoreContext* context) override;
 
@@ -26,6 +27,7 @@ public:
     void apply(Core* object, float time, float mix);
 
     StatusCode import(ImportStack& importStack) override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
 
 private:
     int closestFrameIndex(float seconds, int exactOffset = 0) const;
@@ -11,6 +11,7 @@ public:
     void computeSeconds(int fps);
 
     StatusCode import(ImportStack& importStack) override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
 
 private:
     float m_seconds;
@@ -27,6 +27,7 @@ public:
     StatusCode onAddedClean(CoreContext* context) override;
 
     StatusCode import(ImportStack& importStack) override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
 
     size_t transitionCount() const { return m_Transitions.size(); }
     StateTransition* transition(size_t index) const
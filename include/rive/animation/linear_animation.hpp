@@ -26,7 +26,11 @@ public:
 
     Loop loop() const { return (Loop)loopValue(); }
 
+    /// Number of keyframes across all of the animation's keyed objects.
+    size_t keyFrameCount() const;
+
     StatusCode import(ImportStack& importStack) override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
 
     float durationSeconds() const;
     /// Returns the start time/ end time of the animation in seconds
@@ -41,6 +41,7 @@ public:
 
     StatusCode onAddedDirty(CoreContext* context) override;
     StatusCode onAddedClean(CoreContext* context) override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
 };
 } // namespace rive
 
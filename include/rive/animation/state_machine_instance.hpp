@@ -10,6 +10,8 @@
 #include "rive/core/field_types/core_callback_type.hpp"
 #include "rive/hit_result.hpp"
 #include "rive/listener_type.hpp"
+#include "rive/math/random.hpp"
+#include "rive/runtime_stats.hpp"
 #include "rive/scene.hpp"
 
 namespace rive
@@ -73,9 +75,19 @@ public:
     // Returns true when the StateMachineInstance has more data to process.
     bool needsAdvance() const;
 
+    // Seeds the generator used to pick random transitions. Instances are
+    // seeded from the clock by default; seeding explicitly makes random
+    // transitions (including those of nested state machines) reproducible.
+    void seedRandom(uint64_t seed);
+
     // Returns a pointer to the instance's stateMachine
     const StateMachine* stateMachine() const { return m_machine; }
 
+    /// Transitions and hit tests since the stats were last reset, the work
+    /// done by the artboard is in artboard()->stats().
+    RuntimeStats& stats() { return m_stats; }
+    const RuntimeStats& stats() const { return m_stats; }
+
     size_t inputCount() const override { return m_inputInstances.size(); }
     SMIInput* input(size_t index) const override;
     SMIBool* getBool(const std::string& name) const override;
@@ -138,6 +150,8 @@ private:
     std::vector<std::unique_ptr<HitComponent>> m_hitComponents;
     StateMachineInstance* m_parentStateMachineInstance = nullptr;
     NestedArtboard* m_parentNestedArtboard = nullptr;
+    Random m_random;
+    RuntimeStats m_stats;
 };
 } // namespace rive
 #endif
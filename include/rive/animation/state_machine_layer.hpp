@@ -29,6 +29,7 @@ public:
     StatusCode onAddedClean(CoreContext* context) override;
 
     StatusCode import(ImportStack& importStack) override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
 
     const AnyState* anyState() const { return m_Any; }
     const EntryState* entryState() const { return m_Entry; }
@@ -29,6 +29,7 @@ public:
     const ListenerAction* action(size_t index) const;
     StatusCode import(ImportStack& importStack) override;
     StatusCode onAddedClean(CoreContext* context) override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
 
     const std::vector<uint32_t>& hitShapeIds() const { return m_HitShapesIds; }
     void performChanges(StateMachineInstance* stateMachineInstance,
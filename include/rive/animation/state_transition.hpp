@@ -90,6 +90,7 @@ public:
     }
 
     StatusCode import(ImportStack& importStack) override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
 
     size_t conditionCount() const { return m_Conditions.size(); }
     TransitionCondition* condition(size_t index) const
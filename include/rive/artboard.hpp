@@ -7,12 +7,16 @@
 #include "rive/generated/artboard_base.hpp"
 #include "rive/hit_info.hpp"
 #include "rive/math/aabb.hpp"
+#include "rive/memory_footprint.hpp"
 #include "rive/renderer.hpp"
+#include "rive/runtime_stats.hpp"
 #include "rive/shapes/shape_paint_container.hpp"
 #include "rive/text/text_value_run.hpp"
 #include "rive/event.hpp"
 #include "rive/audio/audio_engine.hpp"
 
+#include <memory>
+#include <mutex>
 #include <queue>
 #include <vector>
 
@@ -24,6 +28,7 @@ class Factory;
 class Node;
 class DrawTarget;
 class ArtboardImporter;
+class DependencySorter;
 class NestedArtboard;
 class ArtboardInstance;
 class LinearAnimationInstance;
@@ -58,12 +63,21 @@ private:
     Drawable* m_FirstDrawable = nullptr;
     bool m_IsInstance = false;
     bool m_FrameOrigin = true;
+    bool m_ShareStaticNestedArtboards = false;
+    bool m_HasViewport = false;
+    AABB m_Viewport;
+    RuntimeStats m_Stats;
+
+    // Instance shared by every static nest of this (source) artboard. Only
+    // held weakly so it goes away with the last nest using it.
+    mutable std::mutex m_SharedInstanceMutex;
+    mutable std::weak_ptr<ArtboardInstance> m_SharedInstance;
 
 #ifdef EXTERNAL_RIVE_AUDIO_ENGINE
     rcp<AudioEngine> m_audioEngine;
 #endif
 
-    void sortDependencies();
+    void sortDependencies(DependencySorter& sorter);
     void sortDrawOrder();
 
     Artboard* getArtboard() override { return this; }
@@ -89,6 +103,10 @@ public:
 
     Factory* factory() const { return m_Factory; }
 
+    /// Work done by this artboard since its stats were last reset.
+    RuntimeStats& stats() { return m_Stats; }
+    const RuntimeStats& stats() const { return m_Stats; }
+
     // EXPERIMENTAL -- for internal testing only for now.
     // DO NOT RELY ON THIS as it may change/disappear in the future.
     Core* hitTest(HitInfo*, const Mat2D* = nullptr);
@@ -111,6 +129,33 @@ public:
         kHideFG,
     };
     void draw(Renderer* renderer, DrawOption = DrawOption::kNormal);
+
+    /// Sets the visible area of the artboard, in the same space as its
+    /// components' world transforms. Drawables (and nested artboards) whose
+    /// bounds or clip are entirely outside of it are not drawn, and nested
+    /// artboards outside of it advance according to offscreenNestedAdvance.
+    /// The viewport is propagated into the nested artboards' own space.
+    /// Changing it makes the next advance report an update.
+    void viewport(const AABB& value);
+    void clearViewport();
+    bool hasViewport() const { return m_HasViewport; }
+    const AABB& viewport() const { return m_Viewport; }
+
+    /// How nested artboards outside the viewport advance.
+    enum class OffscreenAdvance
+    {
+        /// Advance as if they were visible.
+        kAdvance,
+        /// Accumulate elapsed time and only advance (by all of it) once
+        /// throttleSeconds have passed or they become visible again.
+        kThrottle,
+        /// Don't advance at all until they're visible again.
+        kPause,
+    };
+    void offscreenNestedAdvance(OffscreenAdvance value, float throttleSeconds = 0.25f);
+    OffscreenAdvance offscreenNestedAdvance() const { return m_OffscreenNestedAdvance; }
+    float offscreenThrottleSeconds() const { return m_OffscreenThrottleSeconds; }
+
     void addToRenderPath(RenderPath* path, const Mat2D& transform);
 
 #ifdef TESTING
@@ -247,6 +292,26 @@ public:
     /// Returns true if the artboard is an instance of another
     bool isInstance() const { return m_IsInstance; }
 
+    /// When enabled on a source artboard, instancing it makes nested
+    /// artboards that aren't animated independently (no nested animations,
+    /// audio events or text modifiers anywhere within them) share a single
+    /// instance that is drawn with each nest's transform, instead of each
+    /// building a full copy. A nest whose render opacity isn't 1 switches to
+    /// an instance of its own.
+    ///
+    /// The shared instance is read only: nests never advance it or change
+    /// its properties, and callers must not change it either (e.g. setting
+    /// text through a nest). That keeps instances of the parent independent,
+    /// they can be advanced and drawn on separate threads as long as each
+    /// parent instance is only used by one thread at a time.
+    void shareStaticNestedArtboards(bool value) { m_ShareStaticNestedArtboards = value; }
+    bool shareStaticNestedArtboards() const { return m_ShareStaticNestedArtboards; }
+
+    /// Returns the instance of this source artboard shared by static nests,
+    /// building it (advanced and drawn once, then frozen) if no nest holds it
+    /// anymore. Safe to call from multiple threads.
+    std::shared_ptr<ArtboardInstance> sharedInstance() const;
+
     /// Returns true when the artboard will shift the origin from the top
     /// left to the relative width/height of the artboard itself. This is
     /// what the editor does visually when you change the origin value to
@@ -260,6 +325,12 @@ public:
     void frameOrigin(bool value);
 
     StatusCode import(ImportStack& importStack) override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
+
+    /// Bytes this artboard holds, including the nested artboard instances it
+    /// owns. A source artboard also counts its animations and state
+    /// machines, which its instances share (and don't count).
+    MemoryFootprint memoryFootprint() const;
 
     float volume() const;
     void volume(float value);
@@ -270,6 +341,8 @@ public:
 #endif
 private:
     float m_volume = 1.0f;
+    OffscreenAdvance m_OffscreenNestedAdvance = OffscreenAdvance::kAdvance;
+    float m_OffscreenThrottleSeconds = 0.25f;
 };
 
 class ArtboardInstance : public Artboard
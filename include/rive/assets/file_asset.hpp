@@ -9,14 +9,21 @@
 namespace rive
 {
 class Factory;
+class FileAssetImporter;
 class FileAsset : public FileAssetBase
 {
+    friend class FileAssetImporter;
+
 private:
     std::vector<uint8_t> m_cdnUuid;
     std::vector<FileAssetReferencer*> m_fileAssetReferencers;
+    size_t m_embeddedSize = 0;
 
 public:
     Span<const uint8_t> cdnUuid() const;
+    /// Bytes of the asset's contents embedded in the file, 0 when it's
+    /// loaded out of band.
+    size_t embeddedSize() const { return m_embeddedSize; }
     std::string cdnUuidStr() const;
 
     void decodeCdnUuid(Span<const uint8_t> value) override;
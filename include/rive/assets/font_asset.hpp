@@ -11,6 +11,7 @@ class FontAsset : public FontAssetBase
 public:
     bool decode(SimpleArray<uint8_t>&, Factory*) override;
     std::string fileExtension() const override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
     const rcp<Font> font() const { return m_font; }
     void font(rcp<Font> font);
 
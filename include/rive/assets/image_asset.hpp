@@ -1,6 +1,7 @@
 #ifndef _RIVE_IMAGE_ASSET_HPP_
 #define _RIVE_IMAGE_ASSET_HPP_
 
+#include "rive/assets/image_header.hpp"
 #include "rive/generated/assets/image_asset_base.hpp"
 #include "rive/renderer.hpp"
 #include "rive/simple_array.hpp"
@@ -8,10 +9,29 @@
 
 namespace rive
 {
+/// Caps how much memory decoded images may take up while a file imports.
+struct ImageBudget
+{
+    /// Bytes of decoded RGBA8 pixels all images together may use, 0 for no
+    /// limit.
+    size_t maxBytes = 0;
+    /// Images that don't fit what's left are decoded downsampled to fit when
+    /// true. Otherwise (or if they'd end up smaller than minDimension, or the
+    /// factory can't scale while decoding) they are deferred, see
+    /// ImageAsset::decodeDeferred.
+    bool downsample = true;
+    uint32_t minDimension = 16;
+    /// Bytes used so far, updated as images are decoded.
+    size_t usedBytes = 0;
+};
+
 class ImageAsset : public ImageAssetBase
 {
 private:
     rcp<RenderImage> m_RenderImage;
+    ImageHeader m_ImageHeader;
+    // Encoded bytes of an image the budget didn't have room for.
+    SimpleArray<uint8_t> m_DeferredBytes;
 
 public:
     ImageAsset() {}
@@ -21,10 +41,27 @@ public:
     std::size_t decodedByteSize = 0;
 #endif
     bool decode(SimpleArray<uint8_t>&, Factory*) override;
+    /// Decodes within budget, downsampling or deferring the image if it
+    /// doesn't fit. Returns false if the image was deferred or failed.
+    bool decode(SimpleArray<uint8_t>&, Factory*, ImageBudget* budget);
     std::string fileExtension() const override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
     RenderImage* renderImage() const { return m_RenderImage.get(); }
     void renderImage(rcp<RenderImage> renderImage);
+
+    /// Dimensions and format read from the encoded bytes, invalid until the
+    /// asset's bytes have been seen (or if they couldn't be recognized).
+    const ImageHeader& imageHeader() const { return m_ImageHeader; }
+    void probe(Span<const uint8_t> bytes);
+
+    /// Bytes the decoded render image takes up as RGBA8, 0 if not decoded.
+    size_t decodedMemory() const;
+
+    bool isDeferred() const { return !m_DeferredBytes.empty(); }
+    /// Decodes an image the budget deferred, optionally downsampled (when
+    /// the factory canDecodeScaled).
+    bool decodeDeferred(Factory*, uint32_t maxDimension = 0);
 };
 } // namespace rive
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#ifndef _RIVE_IMAGE_HEADER_HPP_
+#define _RIVE_IMAGE_HEADER_HPP_
+
+#include "rive/span.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace rive
+{
+/// What can be learned about an encoded image from its header alone, without
+/// decoding any pixels. Header only so the decoders library can share it.
+struct ImageHeader
+{
+    enum class Format : uint8_t
+    {
+        unknown,
+        png,
+        jpeg,
+        webp,
+    };
+
+    Format format = Format::unknown;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    bool hasAlpha = false;
+
+    bool valid() const { return format != Format::unknown && width != 0 && height != 0; }
+
+    /// Bytes the image takes up decoded as 8 bit RGBA (what renderers upload).
+    size_t decodedByteSize() const { return (size_t)width * height * 4; }
+
+    /// Reads the header from the start of an encoded PNG, JPEG or WebP.
+    /// Returns false (and an invalid header) if bytes isn't a recognized
+    /// image or is truncated before its dimensions.
+    static bool probe(Span<const uint8_t> bytes, ImageHeader* header)
+    {
+        *header = ImageHeader();
+        const uint8_t* data = bytes.data();
+        size_t size = bytes.size();
+        if (size >= 8 && memcmp(data, "\x89PNG\r\n\x1a\n", 8) == 0)
+        {
+            return probePng(data, size, header);
+        }
+        if (size >= 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF)
+        {
+            return probeJpeg(data, size, header);
+        }
+        if (size >= 12 && memcmp(data, "RIFF", 4) == 0 && memcmp(data + 8, "WEBP", 4) == 0)
+        {
+            return probeWebP(data, size, header);
+        }
+        return false;
+    }
+
+    /// Dimensions of a width x height image scaled down (never up) so neither
+    /// side exceeds maxDimension, preserving the aspect ratio. 0 is no limit.
+    static void scaledSize(uint32_t width,
+                           uint32_t height,
+                           uint32_t maxDimension,
+                           uint32_t* scaledWidth,
+                           uint32_t* scaledHeight)
+    {
+        uint32_t largest = width > height ? width : height;
+        if (maxDimension == 0 || largest <= maxDimension)
+        {
+            *scaledWidth = width;
+            *scaledHeight = height;
+            return;
+        }
+        *scaledWidth = (uint32_t)((uint64_t)width * maxDimension / largest);
+        *scaledHeight = (uint32_t)((uint64_t)height * maxDimension / largest);
+        *scaledWidth = *scaledWidth == 0 ? 1 : *scaledWidth;
+        *scaledHeight = *scaledHeight == 0 ? 1 : *scaledHeight;
+    }
+
+private:
+    static uint32_t readU32BE(const uint8_t* p)
+    {
+        return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    }
+    static uint32_t readU16BE(const uint8_t* p) { return ((uint32_t)p[0] << 8) | p[1]; }
+    static uint32_t readU16LE(const uint8_t* p) { return ((uint32_t)p[1] << 8) | p[0]; }
+    static uint32_t readU24LE(const uint8_t* p)
+    {
+        return ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | p[0];
+    }
+
+    static bool probePng(const uint8_t* data, size_t size, ImageHeader* header)
+    {
+        // The IHDR chunk always comes first.
+        if (size < 8 + 8 + 13 || memcmp(data + 12, "IHDR", 4) != 0)
+        {
+            return false;
+        }
+        const uint8_t* ihdr = data + 16;
+        uint8_t colorType = ihdr[9];
+        header->format = Format::png;
+        header->width = readU32BE(ihdr);
+        header->height = readU32BE(ihdr + 4);
+        // Gray + alpha or RGBA.
+        header->hasAlpha = colorType == 4 || colorType == 6;
+        // A tRNS chunk before the image data also adds alpha.
+        size_t offset = 8;
+        while (!header->hasAlpha && offset + 8 <= size)
+        {
+            uint32_t length = readU32BE(data + offset);
+            const uint8_t* type = data + offset + 4;
+            if (memcmp(type, "IDAT", 4) == 0 || memcmp(type, "IEND", 4) == 0)
+            {
+                break;
+            }
+            header->hasAlpha = memcmp(type, "tRNS", 4) == 0;
+            offset += (size_t)length + 12;
+        }
+        return header->valid();
+    }
+
+    static bool probeJpeg(const uint8_t* data, size_t size, ImageHeader* header)
+    {
+        size_t offset = 2;
+        while (offset + 4 <= size)
+        {
+            if (data[offset] != 0xFF)
+            {
+                return false;
+            }
+            uint8_t marker = data[offset + 1];
+            if (marker == 0xFF)
+            {
+                // Fill byte.
+                offset++;
+                continue;
+            }
+            if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD9))
+            {
+                // Standalone markers have no length.
+                offset += 2;
+                continue;
+            }
+            uint32_t length = readU16BE(data + offset + 2);
+            bool isStartOfFrame =
+                marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 &&
+                marker != 0xCC;
+            if (isStartOfFrame)
+            {
+                if (offset + 9 > size)
+                {
+                    return false;
+                }
+                header->format = Format::jpeg;
+                header->height = readU16BE(data + offset + 5);
+                header->width = readU16BE(data + offset + 7);
+                return header->valid();
+            }
+            offset += 2 + length;
+        }
+        return false;
+    }
+
+    static bool probeWebP(const uint8_t* data, size_t size, ImageHeader* header)
+    {
+        if (size < 30)
+        {
+            return false;
+        }
+        const uint8_t* chunk = data + 12;
+        header->format = Format::webp;
+        if (memcmp(chunk, "VP8X", 4) == 0)
+        {
+            header->hasAlpha = (chunk[8] & 0x10) != 0;
+            header->width = readU24LE(chunk + 12) + 1;
+            header->height = readU24LE(chunk + 15) + 1;
+        }
+        else if (memcmp(chunk, "VP8L", 4) == 0)
+        {
+            if (chunk[8] != 0x2F)
+            {
+                return false;
+            }
+            uint32_t bits = readU16LE(chunk + 9) | (readU16LE(chunk + 11) << 16);
+            header->width = (bits & 0x3FFF) + 1;
+            header->height = ((bits >> 14) & 0x3FFF) + 1;
+            header->hasAlpha = (bits >> 28) & 1;
+        }
+        else if (memcmp(chunk, "VP8 ", 4) == 0)
+        {
+            // Lossy, the frame header follows a 3 byte tag and start code.
+            const uint8_t* frame = chunk + 8;
+            if (frame[3] != 0x9D || frame[4] != 0x01 || frame[5] != 0x2A)
+            {
+                return false;
+            }
+            header->width = readU16LE(frame + 6) & 0x3FFF;
+            header->height = readU16LE(frame + 8) & 0x3FFF;
+        }
+        else
+        {
+            return false;
+        }
+        return header->valid();
+    }
+};
+} // namespace rive
+#endif
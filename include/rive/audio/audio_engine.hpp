@@ -4,10 +4,14 @@
 
 #include "rive/refcnt.hpp"
 #include "rive/span.hpp"
+#include "rive/spsc_queue.hpp"
+#include <atomic>
+#include <list>
 #include <vector>
 #include <stdio.h>
 #include <cstdint>
 #include <mutex>
+#include <unordered_map>
 
 typedef struct ma_engine ma_engine;
 typedef struct ma_sound ma_sound;
@@ -20,6 +24,15 @@ class AudioSound;
 class AudioSource;
 class LevelsNode;
 class Artboard;
+
+// PCM for a whole source, decoded to the engine's channels and sample rate.
+class DecodedAudio : public RefCnt<DecodedAudio>
+{
+public:
+    std::vector<float> samples;
+    uint64_t lengthInFrames = 0;
+};
+
 class AudioEngine : public RefCnt<AudioEngine>
 {
     friend class AudioSound;
@@ -29,6 +42,9 @@ class AudioEngine : public RefCnt<AudioEngine>
 public:
     static const uint32_t defaultNumChannels = 2;
     static const uint32_t defaultSampleRate = 48000;
+    static const size_t defaultMaxCachedClipBytes = 1024 * 1024;
+    static const size_t defaultMaxDecodeCacheBytes = 16 * 1024 * 1024;
+    static const size_t defaultVoicePoolSize = 16;
 
     static rcp<AudioEngine> Make(uint32_t numChannels, uint32_t sampleRate);
 
@@ -40,6 +56,8 @@ public:
     uint64_t timeInFrames();
 
     ~AudioEngine();
+    // The returned sound is the caller's until it completes or is stopped,
+    // after that the engine may reuse it for another play.
     rcp<AudioSound> play(rcp<AudioSource> source,
                          uint64_t startTime,
                          uint64_t endTime,
@@ -48,6 +66,15 @@ public:
 
     static rcp<AudioEngine> RuntimeEngine(bool makeWhenNecessary = true);
 
+    // Compressed sources that decode to at most maxClipBytes of PCM are
+    // decoded once and shared by every sound that plays them. Decoded clips
+    // are evicted least recently used first to stay within maxCacheBytes.
+    // Passing 0 for maxClipBytes disables the cache.
+    void decodeCacheLimits(size_t maxClipBytes, size_t maxCacheBytes);
+
+    // Number of finished sounds kept around to be recycled by play.
+    void voicePoolSize(size_t size);
+
 #ifdef EXTERNAL_RIVE_AUDIO_ENGINE
     bool readAudioFrames(float* frames, uint64_t numFrames, uint64_t* framesRead = nullptr);
     bool sumAudioFrames(float* frames, uint64_t numFrames);
@@ -63,8 +90,16 @@ public:
     void stop();
     void stop(Artboard* artboard);
 
+    // Releases sounds that finished playing. Completion is signaled from the
+    // audio thread without locking, the actual cleanup happens here. Call it
+    // regularly from the thread that plays sounds (play also calls it).
+    void pump();
+
 #ifdef TESTING
     size_t playingSoundCount();
+    size_t decodeCacheCount();
+    size_t decodeCacheBytes();
+    size_t freeVoiceCount();
 #endif
 private:
     AudioEngine(ma_engine* engine);
@@ -72,13 +107,50 @@ private:
     ma_engine* m_engine;
     std::mutex m_mutex;
 
-    void soundCompleted(rcp<AudioSound> sound);
     void unlinkSound(rcp<AudioSound> sound);
+    void disposeCompletedSounds();
 
+    // Sounds that finished on the audio thread, each holding a reference that
+    // pump adopts. If the queue fills up, the overflow flag tells pump to
+    // find the remaining completed sounds by scanning the playing list.
+    SPSCQueue<AudioSound*, 1024> m_completedQueue;
+    std::atomic<bool> m_completedQueueOverflowed{false};
     std::vector<rcp<AudioSound>> m_completedSounds;
     rcp<AudioSound> m_playingSoundsHead;
     static void SoundCompleted(void* pUserData, ma_sound* pSound);
 
+    struct DecodeCacheEntry
+    {
+        rcp<AudioSource> source;
+        rcp<DecodedAudio> audio;
+    };
+    // Most recently used first.
+    std::list<DecodeCacheEntry> m_decodeCache;
+    std::unordered_map<const AudioSource*, std::list<DecodeCacheEntry>::iterator>
+        m_decodeCacheLookup;
+    size_t m_decodeCacheBytes = 0;
+    size_t m_maxCachedClipBytes = defaultMaxCachedClipBytes;
+    size_t m_maxDecodeCacheBytes = defaultMaxDecodeCacheBytes;
+
+    // Returns the cached clip for source. If it isn't cached but is short
+    // enough to be, sets decodeFrames to the frames to decode it into.
+    rcp<DecodedAudio> cachedAudio(const rcp<AudioSource>& source, uint64_t* decodeFrames);
+    // Decodes source to the engine's format. Touches no engine state, so
+    // play calls it without holding m_mutex.
+    rcp<DecodedAudio> decodeAudio(const rcp<AudioSource>& source, uint64_t estimatedFrames);
+    // Caches a clip from decodeAudio, returning the one already cached if
+    // another play decoded the same source meanwhile.
+    rcp<DecodedAudio> cacheAudio(const rcp<AudioSource>& source, rcp<DecodedAudio> decoded);
+    void trimDecodeCache(size_t maxBytes);
+
+    std::vector<rcp<AudioSound>> m_freeVoices;
+    size_t m_voicePoolSize = defaultVoicePoolSize;
+
+    rcp<AudioSound> acquireVoice(rcp<AudioSource> source, Artboard* artboard);
+    void recycleVoice(rcp<AudioSound> sound);
+    // Returns a voice that failed to start to the pool.
+    void releaseVoice(rcp<AudioSound> sound);
+
 #ifdef WITH_RIVE_AUDIO_TOOLS
     void measureLevels(const float* frames, uint32_t frameCount);
     std::vector<float> m_levels;
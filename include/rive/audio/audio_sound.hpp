@@ -10,6 +10,7 @@ namespace rive
 {
 class AudioEngine;
 class Artboard;
+class DecodedAudio;
 
 struct ma_end_clipped_decoder
 {
@@ -110,6 +111,8 @@ public:
 
 private:
     AudioSound(AudioEngine* engine, rcp<AudioSource> source, Artboard* artboard);
+    // Prepares a disposed sound to be played again.
+    void reset(rcp<AudioSource> source, Artboard* artboard);
     ma_end_clipped_decoder* clippedDecoder() { return &m_decoder; }
     ma_audio_buffer* buffer() { return &m_buffer; }
     ma_sound* sound() { return &m_sound; }
@@ -119,9 +122,13 @@ private:
     ma_audio_buffer m_buffer;
     ma_sound m_sound;
     rcp<AudioSource> m_source;
+    rcp<DecodedAudio> m_decodedAudio;
 
     // This is storage used by the AudioEngine.
     bool m_isDisposed;
+    // Set while play's caller owns the sound, cleared once the engine retires
+    // it (completed or stopped). Only retired sounds go back to the pool.
+    bool m_isHandedOut;
     rcp<AudioSound> m_nextPlaying;
     rcp<AudioSound> m_prevPlaying;
     AudioEngine* m_engine;
@@ -31,6 +31,8 @@ public:
 
     uint32_t channels();
     uint32_t sampleRate();
+    // Length of the source in frames at its own sample rate.
+    uint64_t lengthInFrames();
     AudioFormat format() const;
     const rive::Span<uint8_t> bytes() const
     {
@@ -56,6 +58,7 @@ private:
     bool m_isBuffered;
     uint32_t m_channels;
     uint32_t m_sampleRate;
+    uint64_t m_lengthInFrames;
     rive::Span<uint8_t> m_fileBytes;
     rive::SimpleArray<uint8_t> m_ownedBytes;
 #endif
@@ -0,0 +1,55 @@
+#ifdef WITH_RIVE_AUDIO
+#ifdef EXTERNAL_RIVE_AUDIO_ENGINE
+#ifndef _RIVE_OFFLINE_AUDIO_RENDERER_HPP_
+#define _RIVE_OFFLINE_AUDIO_RENDERER_HPP_
+
+#include "rive/refcnt.hpp"
+#include "rive/span.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace rive
+{
+class AudioEngine;
+class Scene;
+
+// Steps a scene (state machine or linear animation instance) at a fixed frame
+// rate and pulls exactly the audio produced during each frame from an engine
+// with no device. Nothing depends on wall clock time, so it runs as fast as
+// possible and the output is the same every time, which makes it suitable
+// for exporting video with sound.
+class OfflineAudioRenderer
+{
+public:
+    // Routes the scene's artboard audio to engine.
+    OfflineAudioRenderer(Scene* scene, rcp<AudioEngine> engine, double framesPerSecond);
+
+    // Number of audio frames the next call to advance will produce. This
+    // varies by one frame when the sample rate isn't a multiple of the frame
+    // rate, so that the audio never drifts from the animation.
+    uint64_t nextAudioFrameCount() const;
+
+    // Advances the scene by one frame and writes the interleaved samples for
+    // that frame to samples. Returns the number of audio frames written, or 0
+    // (without advancing) if samples can't hold nextAudioFrameCount() frames.
+    uint64_t advance(Span<float> samples);
+
+    // Advances frameCount frames, appending their samples to samples.
+    void render(uint64_t frameCount, std::vector<float>& samples);
+
+    // Number of frames advanced so far.
+    uint64_t frame() const { return m_frame; }
+
+private:
+    uint64_t audioFrameAt(uint64_t frame) const;
+
+    Scene* m_scene;
+    rcp<AudioEngine> m_engine;
+    double m_framesPerSecond;
+    uint64_t m_frame = 0;
+};
+} // namespace rive
+
+#endif
+#endif
+#endif
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#ifndef _RIVE_COALESCING_RENDERER_HPP_
+#define _RIVE_COALESCING_RENDERER_HPP_
+
+#include "rive/renderer.hpp"
+
+#include <vector>
+
+namespace rive
+{
+/// Renderer that wraps another one and only forwards the state changes a draw
+/// actually depends on. save(), restore(), transform() and clipPath() are
+/// tracked and applied lazily right before the next draw, state already
+/// applied to the backend is kept, so consecutive drawables sharing the same
+/// clips don't re-clip and paints sharing a transform don't re-transform.
+///
+/// The backend's own save/restore balance is maintained: once the outermost
+/// save is restored (or restoreBackend() is called) the backend is back to
+/// the state it was in when wrapped, apart from transforms issued outside of
+/// any save.
+class CoalescingRenderer : public Renderer
+{
+public:
+    struct Counter
+    {
+        uint32_t received = 0;
+        uint32_t forwarded = 0;
+
+        uint32_t elided() const { return received > forwarded ? received - forwarded : 0; }
+    };
+
+    struct Counters
+    {
+        Counter save;
+        Counter restore;
+        Counter transform;
+        Counter clipPath;
+        // Draws are always forwarded.
+        uint32_t draws = 0;
+    };
+
+    explicit CoalescingRenderer(Renderer* backend);
+    ~CoalescingRenderer() override;
+
+    Renderer* backend() const { return m_backend; }
+
+    const Counters& counters() const { return m_counters; }
+    void resetCounters() { m_counters = Counters(); }
+
+    /// Pops everything this renderer pushed onto the backend.
+    void restoreBackend();
+
+    void save() override;
+    void restore() override;
+    void transform(const Mat2D& transform) override;
+    void drawPath(RenderPath* path, RenderPaint* paint) override;
+    void clipPath(RenderPath* path) override;
+    void drawImage(const RenderImage*, BlendMode, float opacity) override;
+    void drawImageMesh(const RenderImage*,
+                       rcp<RenderBuffer> vertices_f32,
+                       rcp<RenderBuffer> uvCoords_f32,
+                       rcp<RenderBuffer> indices_u16,
+                       uint32_t vertexCount,
+                       uint32_t indexCount,
+                       BlendMode,
+                       float opacity) override;
+
+private:
+    // A transform or a clip, the state at any point is the ordered list of
+    // entries applied since the renderer was wrapped.
+    struct Entry
+    {
+        Mat2D transform;
+        RenderPath* clip = nullptr;
+
+        bool operator==(const Entry& other) const
+        {
+            return clip == other.clip && (clip != nullptr || transform == other.transform);
+        }
+    };
+
+    struct AppliedEntry
+    {
+        Entry entry;
+        // Keeps the clip alive so its address can't be reused while applied.
+        rcp<RenderPath> clipRef;
+        // Whether a backend save() was issued right before this entry.
+        bool saved;
+    };
+
+    size_t appliedPrefix() const;
+    void popBackend(size_t count);
+    void syncBackend();
+
+    Renderer* m_backend;
+    std::vector<Entry> m_entries;
+    // m_entries size at each unrestored save().
+    std::vector<size_t> m_saves;
+    // Entries currently applied to the backend.
+    std::vector<AppliedEntry> m_applied;
+    Counters m_counters;
+};
+} // namespace rive
+#endif
@@ -25,6 +25,10 @@ public:
 
     virtual RenderPath* renderPath() = 0;
 
+    /// Bytes of path data held on the CPU, 0 when unknown (or held by the
+    /// backend elsewhere).
+    virtual size_t byteSize() const { return 0; }
+
     // non-virtual helpers
 
     void addRect(float x, float y, float width, float height)
@@ -13,12 +13,15 @@ class Artboard;
 class Component : public ComponentBase
 {
     friend class Artboard;
+    friend class DependencySorter;
 
 private:
     ContainerComponent* m_Parent = nullptr;
     std::vector<Component*> m_Dependents;
 
     unsigned int m_GraphOrder;
+    // Scratch slot used by DependencySorter while sorting.
+    uint32_t m_SortSlot = 0;
     Artboard* m_Artboard = nullptr;
 
 protected:
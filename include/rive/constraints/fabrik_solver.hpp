@@ -0,0 +1,44 @@
+#ifndef _RIVE_FABRIK_SOLVER_HPP_
+#define _RIVE_FABRIK_SOLVER_HPP_
+#include "rive/math/vec2d.hpp"
+#include <vector>
+
+namespace rive
+{
+/// Iterative FABRIK (Forward And Backward Reaching Inverse Kinematics)
+/// solver for a chain of any length. Joints are stored as separate x/y/length
+/// arrays so a chain is contiguous in memory and the storage is reused
+/// between solves.
+class FabrikSolver
+{
+public:
+    /// Resize to hold a chain with jointCount joints (bone count + 1 for the
+    /// tip).
+    void resize(size_t jointCount);
+    size_t jointCount() const { return m_x.size(); }
+
+    void joint(size_t index, Vec2D position)
+    {
+        m_x[index] = position.x;
+        m_y[index] = position.y;
+    }
+    Vec2D joint(size_t index) const { return Vec2D(m_x[index], m_y[index]); }
+
+    /// Measure the segment lengths from the current joint positions. Call
+    /// this after setting the joints and before solving.
+    void measure();
+
+    /// Move the joints so the tip reaches towards target, keeping the root in
+    /// place. Stops after maxIterations or once the tip is within tolerance
+    /// of the target. Returns the number of iterations used.
+    int solve(Vec2D target, int maxIterations, float tolerance);
+
+private:
+    std::vector<float> m_x;
+    std::vector<float> m_y;
+    std::vector<float> m_lengths;
+    float m_totalLength = 0.0f;
+};
+} // namespace rive
+
+#endif
@@ -1,11 +1,12 @@
 #ifndef _RIVE_FOLLOW_PATH_CONSTRAINT_HPP_
 #define _RIVE_FOLLOW_PATH_CONSTRAINT_HPP_
 #include "rive/generated/constraints/follow_path_constraint_base.hpp"
-#include "rive/math/transform_components.hpp"
+#include "rive/math/decompose_cache.hpp"
 #include "rive/shapes/metrics_path.hpp"
 #include <stdio.h>
 namespace rive
 {
+class Path;
 class FollowPathConstraint : public FollowPathConstraintBase
 {
 
@@ -19,10 +20,21 @@ public:
     void buildDependencies() override;
 
 private:
+    void buildContours();
+
     RawPath m_rawPath;
+    std::vector<Path*> m_paths;
     std::vector<rcp<ContourMeasure>> m_contours;
+    float m_totalLength = 0.0f;
+
+    // Where the last lookup landed, the next one usually lands in the same
+    // spot (or right after it) so we start searching from here.
+    mutable size_t m_contourCursor = 0;
+    mutable float m_contourCursorStart = 0.0f;
+    mutable size_t m_segmentCursor = 0;
     TransformComponents m_ComponentsA;
     TransformComponents m_ComponentsB;
+    DecomposeCache m_DecomposeA;
 };
 } // namespace rive
 
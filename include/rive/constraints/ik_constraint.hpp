@@ -1,6 +1,7 @@
 #ifndef _RIVE_I_KCONSTRAINT_HPP_
 #define _RIVE_I_KCONSTRAINT_HPP_
 #include "rive/generated/constraints/ik_constraint_base.hpp"
+#include "rive/constraints/fabrik_solver.hpp"
 #include "rive/math/mat2d.hpp"
 #include "rive/math/transform_components.hpp"
 #include <vector>
@@ -22,13 +23,40 @@ private:
     std::vector<BoneChainLink> m_FkChain;
     void solve1(BoneChainLink* fk1, const Vec2D& worldTargetTranslation);
     void solve2(BoneChainLink* fk1, BoneChainLink* fk2, const Vec2D& worldTargetTranslation);
+    void solveFabrik(const Vec2D& worldTargetTranslation);
     void constrainRotation(BoneChainLink& fk, float rotation);
 
 public:
+    enum class Solver : uint8_t
+    {
+        /// Closed form one and two bone solve, longer chains repeatedly apply
+        /// the two bone solve from each bone to the tip. Matches the editor.
+        kAnalytic,
+        /// Iterative FABRIK solve of the whole chain at once. Cheaper and
+        /// more stable for long chains, ignores invertDirection.
+        kFabrik,
+    };
+
+    /// Runtime only choice of solver for chains of two or more bones.
+    void solver(Solver value);
+    Solver solver() const { return m_Solver; }
+
+    /// Iteration and error budget for the iterative solver. It stops once
+    /// the tip is within tolerance (in world units) of the target.
+    void solverBudget(int maxIterations, float tolerance);
+    int solverIterations() const { return m_SolverIterations; }
+    float solverTolerance() const { return m_SolverTolerance; }
+
     void markConstraintDirty() override;
     StatusCode onAddedClean(CoreContext* context) override;
     void constrain(TransformComponent* component) override;
     void buildDependencies() override;
+
+private:
+    Solver m_Solver = Solver::kAnalytic;
+    int m_SolverIterations = 10;
+    float m_SolverTolerance = 0.01f;
+    FabrikSolver m_Fabrik;
 };
 } // namespace rive
 
@@ -1,7 +1,7 @@
 #ifndef _RIVE_SCALE_CONSTRAINT_HPP_
 #define _RIVE_SCALE_CONSTRAINT_HPP_
 #include "rive/generated/constraints/scale_constraint_base.hpp"
-#include "rive/math/transform_components.hpp"
+#include "rive/math/decompose_cache.hpp"
 #include <stdio.h>
 namespace rive
 {
@@ -10,6 +10,8 @@ class ScaleConstraint : public ScaleConstraintBase
 private:
     TransformComponents m_ComponentsA;
     TransformComponents m_ComponentsB;
+    DecomposeCache m_DecomposeA;
+    DecomposeCache m_DecomposeB;
 
 public:
     void constrain(TransformComponent* component) override;
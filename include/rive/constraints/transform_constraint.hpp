@@ -1,7 +1,7 @@
 #ifndef _RIVE_TRANSFORM_CONSTRAINT_HPP_
 #define _RIVE_TRANSFORM_CONSTRAINT_HPP_
 #include "rive/generated/constraints/transform_constraint_base.hpp"
-#include "rive/math/transform_components.hpp"
+#include "rive/math/decompose_cache.hpp"
 
 #include <stdio.h>
 namespace rive
@@ -11,6 +11,8 @@ class TransformConstraint : public TransformConstraintBase
 private:
     TransformComponents m_ComponentsA;
     TransformComponents m_ComponentsB;
+    DecomposeCache m_DecomposeA;
+    DecomposeCache m_DecomposeB;
 
 public:
     virtual const Mat2D targetTransform() const;
@@ -9,6 +9,7 @@ namespace rive
 {
 class CoreContext;
 class ImportStack;
+struct MemoryFootprint;
 class Core
 {
 public:
@@ -51,6 +52,10 @@ public:
     virtual StatusCode onAddedClean(CoreContext* context) { return StatusCode::Ok; }
 
     virtual StatusCode import(ImportStack& importStack) { return StatusCode::Ok; }
+
+    /// Adds the memory used by this object, and anything it owns, to
+    /// footprint. By default that's the size of the object itself.
+    virtual void addMemoryFootprint(MemoryFootprint& footprint) const;
 };
 } // namespace rive
 #endif
@@ -1,22 +1,45 @@
 #ifndef _RIVE_DEPENDENCYSORTER_HPP_
 #define _RIVE_DEPENDENCYSORTER_HPP_
 
-#include <unordered_set>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace rive
 {
 class Component;
+
+// Iterative depth-first topological sort over Component dependents. Visit
+// state lives in flat arrays indexed by a per-component slot, so a sorter can
+// be kept around and reused for multiple sorts without reallocating.
 class DependencySorter
 {
 private:
-    std::unordered_set<Component*> m_Perm;
-    std::unordered_set<Component*> m_Temp;
+    enum class Mark : uint8_t
+    {
+        Temporary,
+        Permanent
+    };
+
+    struct Frame
+    {
+        Component* component;
+        size_t nextDependent;
+    };
+
+    std::vector<Component*> m_Components;
+    std::vector<Mark> m_Marks;
+    std::vector<Frame> m_Stack;
+
+    // Returns the slot for component if it has been seen in the current sort.
+    bool findSlot(Component* component, uint32_t& slot) const;
 
 public:
-    void sort(Component* root, std::vector<Component*>& order);
-    bool visit(Component* component, std::vector<Component*>& order);
+    // Fills order with root and everything that depends on it such that each
+    // component comes before its dependents. Returns false if a cycle was
+    // found, in which case order only contains what was sorted before it.
+    bool sort(Component* root, std::vector<Component*>& order);
 };
 } // namespace rive
 
-#endif
\ No newline at end of file
+#endif
@@ -5,6 +5,7 @@
 #include "rive/renderer.hpp"
 #include "rive/clip_result.hpp"
 #include "rive/drawable_flag.hpp"
+#include "rive/math/aabb.hpp"
 #include <vector>
 
 namespace rive
@@ -25,6 +26,8 @@ private:
     DrawRules* flattenedDrawRules = nullptr;
     Drawable* prev = nullptr;
     Drawable* next = nullptr;
+    /// Position in the artboard's sorted draw order (0 draws first).
+    uint32_t m_DrawOrderIndex = 0;
 
 public:
     BlendMode blendMode() const { return (BlendMode)blendModeValue(); }
@@ -33,6 +36,7 @@ public:
     virtual Core* hitTest(HitInfo*, const Mat2D&) = 0;
     void addClippingShape(ClippingShape* shape);
     inline const std::vector<ClippingShape*>& clippingShapes() const { return m_ClippingShapes; }
+    uint32_t drawOrderIndex() const { return m_DrawOrderIndex; }
 
     inline bool isHidden() const
     {
@@ -48,6 +52,14 @@ public:
     }
 
     StatusCode onAddedDirty(CoreContext* context) override;
+
+    /// Conservative world space bounds of everything draw() can render.
+    /// Returns false when they aren't known.
+    virtual bool drawBounds(AABB* bounds) { return false; }
+
+    /// Returns true when nothing this draws (after clipping) can land inside
+    /// area, which is in world space.
+    bool isOutside(const AABB& area);
 };
 } // namespace rive
 
@@ -57,6 +57,13 @@ public:
 
     virtual rcp<RenderImage> decodeImage(Span<const uint8_t>) = 0;
 
+    // Decodes an image scaled down (never up) so neither side exceeds
+    // maxDimension, 0 decodes at full size. Factories that can't scale while
+    // decoding fall back to decodeImage and report false from
+    // canDecodeScaled, so callers know the size won't be honored.
+    virtual rcp<RenderImage> decodeScaledImage(Span<const uint8_t>, uint32_t maxDimension);
+    virtual bool canDecodeScaled() const { return false; }
+
     virtual rcp<Font> decodeFont(Span<const uint8_t>);
 
     virtual rcp<AudioSource> decodeAudio(Span<const uint8_t>);
@@ -16,6 +16,7 @@ namespace rive
 class BinaryReader;
 class RuntimeHeader;
 class Factory;
+struct ImageBudget;
 
 ///
 /// Tracks the success/failure result when importing a Rive file.
@@ -52,11 +53,14 @@ public:
     /// @param result is an optional status result.
     /// @param assetLoader is an optional helper to load assets which
     /// cannot be found in-band.
+    /// @param imageBudget optionally caps the memory in-band images are
+    /// decoded into, images past it are downsampled or deferred.
     /// @returns a pointer to the file, or null on failure.
     static std::unique_ptr<File> import(Span<const uint8_t> data,
                                         Factory*,
                                         ImportResult* result = nullptr,
-                                        FileAssetLoader* assetLoader = nullptr);
+                                        FileAssetLoader* assetLoader = nullptr,
+                                        ImageBudget* imageBudget = nullptr);
 
     /// @returns the file's backboard. All files have exactly one backboard.
     Backboard* backboard() const { return m_backboard; }
@@ -67,6 +71,18 @@ public:
 
     const std::vector<FileAsset*>& assets() const;
 
+    /// @returns the bytes the file's images would take up decoded at full
+    /// size (as RGBA8), estimated from their headers.
+    size_t imageMemoryEstimate() const;
+
+    /// @returns the bytes the file's currently decoded images take up.
+    size_t decodedImageMemory() const;
+
+    /// @returns the memory the file holds: its source artboards (with their
+    /// animations and state machines) and its assets. Instances made from
+    /// the file aren't included, see Artboard::memoryFootprint.
+    MemoryFootprint memoryFootprint() const;
+
     // Instances
     std::unique_ptr<ArtboardInstance> artboardDefault() const;
     std::unique_ptr<ArtboardInstance> artboardAt(size_t index) const;
@@ -82,6 +98,11 @@ public:
     /// index is out of range.
     Artboard* artboard(size_t index) const;
 
+    /// Enables sharing a single instance between nested artboards that
+    /// aren't animated independently, for every artboard in the file. See
+    /// Artboard::shareStaticNestedArtboards.
+    void shareStaticNestedArtboards(bool value);
+
 #ifdef WITH_RIVE_TOOLS
     /// Strips FileAssetContents for FileAssets of given typeKeys.
     /// @param data the raw data of the file.
@@ -112,6 +133,9 @@ private:
     /// The helper used to load assets when they're not provided in-band
     /// with the file.
     FileAssetLoader* m_assetLoader;
+
+    /// Only set while importing.
+    ImageBudget* m_imageBudget = nullptr;
 };
 } // namespace rive
 #endif
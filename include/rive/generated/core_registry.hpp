@@ -378,6 +378,452 @@ public:
         }
         return nullptr;
     }
+    static size_t objectSize(int typeKey)
+    {
+        switch (typeKey)
+        {
+            case DrawTargetBase::typeKey:
+                return sizeof(DrawTarget);
+            case CustomPropertyNumberBase::typeKey:
+                return sizeof(CustomPropertyNumber);
+            case DistanceConstraintBase::typeKey:
+                return sizeof(DistanceConstraint);
+            case IKConstraintBase::typeKey:
+                return sizeof(IKConstraint);
+            case FollowPathConstraintBase::typeKey:
+                return sizeof(FollowPathConstraint);
+            case TranslationConstraintBase::typeKey:
+                return sizeof(TranslationConstraint);
+            case TransformConstraintBase::typeKey:
+                return sizeof(TransformConstraint);
+            case ScaleConstraintBase::typeKey:
+                return sizeof(ScaleConstraint);
+            case RotationConstraintBase::typeKey:
+                return sizeof(RotationConstraint);
+            case NodeBase::typeKey:
+                return sizeof(Node);
+            case NestedArtboardBase::typeKey:
+                return sizeof(NestedArtboard);
+            case SoloBase::typeKey:
+                return sizeof(Solo);
+            case ListenerFireEventBase::typeKey:
+                return sizeof(ListenerFireEvent);
+            case NestedSimpleAnimationBase::typeKey:
+                return sizeof(NestedSimpleAnimation);
+            case AnimationStateBase::typeKey:
+                return sizeof(AnimationState);
+            case NestedTriggerBase::typeKey:
+                return sizeof(NestedTrigger);
+            case KeyedObjectBase::typeKey:
+                return sizeof(KeyedObject);
+            case AnimationBase::typeKey:
+                return sizeof(Animation);
+            case BlendAnimationDirectBase::typeKey:
+                return sizeof(BlendAnimationDirect);
+            case StateMachineNumberBase::typeKey:
+                return sizeof(StateMachineNumber);
+            case CubicValueInterpolatorBase::typeKey:
+                return sizeof(CubicValueInterpolator);
+            case TransitionTriggerConditionBase::typeKey:
+                return sizeof(TransitionTriggerCondition);
+            case KeyedPropertyBase::typeKey:
+                return sizeof(KeyedProperty);
+            case StateMachineListenerBase::typeKey:
+                return sizeof(StateMachineListener);
+            case KeyFrameIdBase::typeKey:
+                return sizeof(KeyFrameId);
+            case KeyFrameBoolBase::typeKey:
+                return sizeof(KeyFrameBool);
+            case ListenerBoolChangeBase::typeKey:
+                return sizeof(ListenerBoolChange);
+            case ListenerAlignTargetBase::typeKey:
+                return sizeof(ListenerAlignTarget);
+            case TransitionNumberConditionBase::typeKey:
+                return sizeof(TransitionNumberCondition);
+            case AnyStateBase::typeKey:
+                return sizeof(AnyState);
+            case CubicInterpolatorComponentBase::typeKey:
+                return sizeof(CubicInterpolatorComponent);
+            case StateMachineLayerBase::typeKey:
+                return sizeof(StateMachineLayer);
+            case KeyFrameStringBase::typeKey:
+                return sizeof(KeyFrameString);
+            case ListenerNumberChangeBase::typeKey:
+                return sizeof(ListenerNumberChange);
+            case CubicEaseInterpolatorBase::typeKey:
+                return sizeof(CubicEaseInterpolator);
+            case StateTransitionBase::typeKey:
+                return sizeof(StateTransition);
+            case NestedBoolBase::typeKey:
+                return sizeof(NestedBool);
+            case KeyFrameDoubleBase::typeKey:
+                return sizeof(KeyFrameDouble);
+            case KeyFrameColorBase::typeKey:
+                return sizeof(KeyFrameColor);
+            case StateMachineBase::typeKey:
+                return sizeof(StateMachine);
+            case StateMachineFireEventBase::typeKey:
+                return sizeof(StateMachineFireEvent);
+            case EntryStateBase::typeKey:
+                return sizeof(EntryState);
+            case LinearAnimationBase::typeKey:
+                return sizeof(LinearAnimation);
+            case StateMachineTriggerBase::typeKey:
+                return sizeof(StateMachineTrigger);
+            case ListenerTriggerChangeBase::typeKey:
+                return sizeof(ListenerTriggerChange);
+            case BlendStateDirectBase::typeKey:
+                return sizeof(BlendStateDirect);
+            case NestedStateMachineBase::typeKey:
+                return sizeof(NestedStateMachine);
+            case ElasticInterpolatorBase::typeKey:
+                return sizeof(ElasticInterpolator);
+            case ExitStateBase::typeKey:
+                return sizeof(ExitState);
+            case NestedNumberBase::typeKey:
+                return sizeof(NestedNumber);
+            case BlendState1DBase::typeKey:
+                return sizeof(BlendState1D);
+            case KeyFrameCallbackBase::typeKey:
+                return sizeof(KeyFrameCallback);
+            case NestedRemapAnimationBase::typeKey:
+                return sizeof(NestedRemapAnimation);
+            case TransitionBoolConditionBase::typeKey:
+                return sizeof(TransitionBoolCondition);
+            case BlendStateTransitionBase::typeKey:
+                return sizeof(BlendStateTransition);
+            case StateMachineBoolBase::typeKey:
+                return sizeof(StateMachineBool);
+            case BlendAnimation1DBase::typeKey:
+                return sizeof(BlendAnimation1D);
+            case LinearGradientBase::typeKey:
+                return sizeof(LinearGradient);
+            case RadialGradientBase::typeKey:
+                return sizeof(RadialGradient);
+            case StrokeBase::typeKey:
+                return sizeof(Stroke);
+            case SolidColorBase::typeKey:
+                return sizeof(SolidColor);
+            case GradientStopBase::typeKey:
+                return sizeof(GradientStop);
+            case TrimPathBase::typeKey:
+                return sizeof(TrimPath);
+            case FillBase::typeKey:
+                return sizeof(Fill);
+            case MeshVertexBase::typeKey:
+                return sizeof(MeshVertex);
+            case ShapeBase::typeKey:
+                return sizeof(Shape);
+            case StraightVertexBase::typeKey:
+                return sizeof(StraightVertex);
+            case CubicAsymmetricVertexBase::typeKey:
+                return sizeof(CubicAsymmetricVertex);
+            case MeshBase::typeKey:
+                return sizeof(Mesh);
+            case PointsPathBase::typeKey:
+                return sizeof(PointsPath);
+            case ContourMeshVertexBase::typeKey:
+                return sizeof(ContourMeshVertex);
+            case RectangleBase::typeKey:
+                return sizeof(Rectangle);
+            case CubicMirroredVertexBase::typeKey:
+                return sizeof(CubicMirroredVertex);
+            case TriangleBase::typeKey:
+                return sizeof(Triangle);
+            case EllipseBase::typeKey:
+                return sizeof(Ellipse);
+            case ClippingShapeBase::typeKey:
+                return sizeof(ClippingShape);
+            case PolygonBase::typeKey:
+                return sizeof(Polygon);
+            case StarBase::typeKey:
+                return sizeof(Star);
+            case ImageBase::typeKey:
+                return sizeof(Image);
+            case CubicDetachedVertexBase::typeKey:
+                return sizeof(CubicDetachedVertex);
+            case EventBase::typeKey:
+                return sizeof(Event);
+            case DrawRulesBase::typeKey:
+                return sizeof(DrawRules);
+            case CustomPropertyBooleanBase::typeKey:
+                return sizeof(CustomPropertyBoolean);
+            case ArtboardBase::typeKey:
+                return sizeof(Artboard);
+            case JoystickBase::typeKey:
+                return sizeof(Joystick);
+            case BackboardBase::typeKey:
+                return sizeof(Backboard);
+            case OpenUrlEventBase::typeKey:
+                return sizeof(OpenUrlEvent);
+            case WeightBase::typeKey:
+                return sizeof(Weight);
+            case BoneBase::typeKey:
+                return sizeof(Bone);
+            case RootBoneBase::typeKey:
+                return sizeof(RootBone);
+            case SkinBase::typeKey:
+                return sizeof(Skin);
+            case TendonBase::typeKey:
+                return sizeof(Tendon);
+            case CubicWeightBase::typeKey:
+                return sizeof(CubicWeight);
+            case TextModifierRangeBase::typeKey:
+                return sizeof(TextModifierRange);
+            case TextStyleFeatureBase::typeKey:
+                return sizeof(TextStyleFeature);
+            case TextVariationModifierBase::typeKey:
+                return sizeof(TextVariationModifier);
+            case TextModifierGroupBase::typeKey:
+                return sizeof(TextModifierGroup);
+            case TextStyleBase::typeKey:
+                return sizeof(TextStyle);
+            case TextStyleAxisBase::typeKey:
+                return sizeof(TextStyleAxis);
+            case TextBase::typeKey:
+                return sizeof(Text);
+            case TextValueRunBase::typeKey:
+                return sizeof(TextValueRun);
+            case CustomPropertyStringBase::typeKey:
+                return sizeof(CustomPropertyString);
+            case FolderBase::typeKey:
+                return sizeof(Folder);
+            case ImageAssetBase::typeKey:
+                return sizeof(ImageAsset);
+            case FontAssetBase::typeKey:
+                return sizeof(FontAsset);
+            case AudioAssetBase::typeKey:
+                return sizeof(AudioAsset);
+            case FileAssetContentsBase::typeKey:
+                return sizeof(FileAssetContents);
+            case AudioEventBase::typeKey:
+                return sizeof(AudioEvent);
+        }
+        return 0;
+    }
+    static const char* objectName(int typeKey)
+    {
+        switch (typeKey)
+        {
+            case DrawTargetBase::typeKey:
+                return "DrawTarget";
+            case CustomPropertyNumberBase::typeKey:
+                return "CustomPropertyNumber";
+            case DistanceConstraintBase::typeKey:
+                return "DistanceConstraint";
+            case IKConstraintBase::typeKey:
+                return "IKConstraint";
+            case FollowPathConstraintBase::typeKey:
+                return "FollowPathConstraint";
+            case TranslationConstraintBase::typeKey:
+                return "TranslationConstraint";
+            case TransformConstraintBase::typeKey:
+                return "TransformConstraint";
+            case ScaleConstraintBase::typeKey:
+                return "ScaleConstraint";
+            case RotationConstraintBase::typeKey:
+                return "RotationConstraint";
+            case NodeBase::typeKey:
+                return "Node";
+            case NestedArtboardBase::typeKey:
+                return "NestedArtboard";
+            case SoloBase::typeKey:
+                return "Solo";
+            case ListenerFireEventBase::typeKey:
+                return "ListenerFireEvent";
+            case NestedSimpleAnimationBase::typeKey:
+                return "NestedSimpleAnimation";
+            case AnimationStateBase::typeKey:
+                return "AnimationState";
+            case NestedTriggerBase::typeKey:
+                return "NestedTrigger";
+            case KeyedObjectBase::typeKey:
+                return "KeyedObject";
+            case AnimationBase::typeKey:
+                return "Animation";
+            case BlendAnimationDirectBase::typeKey:
+                return "BlendAnimationDirect";
+            case StateMachineNumberBase::typeKey:
+                return "StateMachineNumber";
+            case CubicValueInterpolatorBase::typeKey:
+                return "CubicValueInterpolator";
+            case TransitionTriggerConditionBase::typeKey:
+                return "TransitionTriggerCondition";
+            case KeyedPropertyBase::typeKey:
+                return "KeyedProperty";
+            case StateMachineListenerBase::typeKey:
+                return "StateMachineListener";
+            case KeyFrameIdBase::typeKey:
+                return "KeyFrameId";
+            case KeyFrameBoolBase::typeKey:
+                return "KeyFrameBool";
+            case ListenerBoolChangeBase::typeKey:
+                return "ListenerBoolChange";
+            case ListenerAlignTargetBase::typeKey:
+                return "ListenerAlignTarget";
+            case TransitionNumberConditionBase::typeKey:
+                return "TransitionNumberCondition";
+            case AnyStateBase::typeKey:
+                return "AnyState";
+            case CubicInterpolatorComponentBase::typeKey:
+                return "CubicInterpolatorComponent";
+            case StateMachineLayerBase::typeKey:
+                return "StateMachineLayer";
+            case KeyFrameStringBase::typeKey:
+                return "KeyFrameString";
+            case ListenerNumberChangeBase::typeKey:
+                return "ListenerNumberChange";
+            case CubicEaseInterpolatorBase::typeKey:
+                return "CubicEaseInterpolator";
+            case StateTransitionBase::typeKey:
+                return "StateTransition";
+            case NestedBoolBase::typeKey:
+                return "NestedBool";
+            case KeyFrameDoubleBase::typeKey:
+                return "KeyFrameDouble";
+            case KeyFrameColorBase::typeKey:
+                return "KeyFrameColor";
+            case StateMachineBase::typeKey:
+                return "StateMachine";
+            case StateMachineFireEventBase::typeKey:
+                return "StateMachineFireEvent";
+            case EntryStateBase::typeKey:
+                return "EntryState";
+            case LinearAnimationBase::typeKey:
+                return "LinearAnimation";
+            case StateMachineTriggerBase::typeKey:
+                return "StateMachineTrigger";
+            case ListenerTriggerChangeBase::typeKey:
+                return "ListenerTriggerChange";
+            case BlendStateDirectBase::typeKey:
+                return "BlendStateDirect";
+            case NestedStateMachineBase::typeKey:
+                return "NestedStateMachine";
+            case ElasticInterpolatorBase::typeKey:
+                return "ElasticInterpolator";
+            case ExitStateBase::typeKey:
+                return "ExitState";
+            case NestedNumberBase::typeKey:
+                return "NestedNumber";
+            case BlendState1DBase::typeKey:
+                return "BlendState1D";
+            case KeyFrameCallbackBase::typeKey:
+                return "KeyFrameCallback";
+            case NestedRemapAnimationBase::typeKey:
+                return "NestedRemapAnimation";
+            case TransitionBoolConditionBase::typeKey:
+                return "TransitionBoolCondition";
+            case BlendStateTransitionBase::typeKey:
+                return "BlendStateTransition";
+            case StateMachineBoolBase::typeKey:
+                return "StateMachineBool";
+            case BlendAnimation1DBase::typeKey:
+                return "BlendAnimation1D";
+            case LinearGradientBase::typeKey:
+                return "LinearGradient";
+            case RadialGradientBase::typeKey:
+                return "RadialGradient";
+            case StrokeBase::typeKey:
+                return "Stroke";
+            case SolidColorBase::typeKey:
+                return "SolidColor";
+            case GradientStopBase::typeKey:
+                return "GradientStop";
+            case TrimPathBase::typeKey:
+                return "TrimPath";
+            case FillBase::typeKey:
+                return "Fill";
+            case MeshVertexBase::typeKey:
+                return "MeshVertex";
+            case ShapeBase::typeKey:
+                return "Shape";
+            case StraightVertexBase::typeKey:
+                return "StraightVertex";
+            case CubicAsymmetricVertexBase::typeKey:
+                return "CubicAsymmetricVertex";
+            case MeshBase::typeKey:
+                return "Mesh";
+            case PointsPathBase::typeKey:
+                return "PointsPath";
+            case ContourMeshVertexBase::typeKey:
+                return "ContourMeshVertex";
+            case RectangleBase::typeKey:
+                return "Rectangle";
+            case CubicMirroredVertexBase::typeKey:
+                return "CubicMirroredVertex";
+            case TriangleBase::typeKey:
+                return "Triangle";
+            case EllipseBase::typeKey:
+                return "Ellipse";
+            case ClippingShapeBase::typeKey:
+                return "ClippingShape";
+            case PolygonBase::typeKey:
+                return "Polygon";
+            case StarBase::typeKey:
+                return "Star";
+            case ImageBase::typeKey:
+                return "Image";
+            case CubicDetachedVertexBase::typeKey:
+                return "CubicDetachedVertex";
+            case EventBase::typeKey:
+                return "Event";
+            case DrawRulesBase::typeKey:
+                return "DrawRules";
+            case CustomPropertyBooleanBase::typeKey:
+                return "CustomPropertyBoolean";
+            case ArtboardBase::typeKey:
+                return "Artboard";
+            case JoystickBase::typeKey:
+                return "Joystick";
+            case BackboardBase::typeKey:
+                return "Backboard";
+            case OpenUrlEventBase::typeKey:
+                return "OpenUrlEvent";
+            case WeightBase::typeKey:
+                return "Weight";
+            case BoneBase::typeKey:
+                return "Bone";
+            case RootBoneBase::typeKey:
+                return "RootBone";
+            case SkinBase::typeKey:
+                return "Skin";
+            case TendonBase::typeKey:
+                return "Tendon";
+            case CubicWeightBase::typeKey:
+                return "CubicWeight";
+            case TextModifierRangeBase::typeKey:
+                return "TextModifierRange";
+            case TextStyleFeatureBase::typeKey:
+                return "TextStyleFeature";
+            case TextVariationModifierBase::typeKey:
+                return "TextVariationModifier";
+            case TextModifierGroupBase::typeKey:
+                return "TextModifierGroup";
+            case TextStyleBase::typeKey:
+                return "TextStyle";
+            case TextStyleAxisBase::typeKey:
+                return "TextStyleAxis";
+            case TextBase::typeKey:
+                return "Text";
+            case TextValueRunBase::typeKey:
+                return "TextValueRun";
+            case CustomPropertyStringBase::typeKey:
+                return "CustomPropertyString";
+            case FolderBase::typeKey:
+                return "Folder";
+            case ImageAssetBase::typeKey:
+                return "ImageAsset";
+            case FontAssetBase::typeKey:
+                return "FontAsset";
+            case AudioAssetBase::typeKey:
+                return "AudioAsset";
+            case FileAssetContentsBase::typeKey:
+                return "FileAssetContents";
+            case AudioEventBase::typeKey:
+                return "AudioEvent";
+        }
+        return nullptr;
+    }
     static void setString(Core* object, int propertyKey, std::string value)
     {
         switch (propertyKey)
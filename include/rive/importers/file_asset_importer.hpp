@@ -11,6 +11,7 @@ class FileAsset;
 class FileAssetContents;
 class FileAssetLoader;
 class Factory;
+struct ImageBudget;
 
 class FileAssetImporter : public ImportStackObject
 {
@@ -18,11 +19,12 @@ private:
     FileAsset* m_FileAsset;
     FileAssetLoader* m_FileAssetLoader;
     Factory* m_Factory;
+    ImageBudget* m_ImageBudget;
     // we will delete this when we go out of scope
     std::unique_ptr<FileAssetContents> m_Content;
 
 public:
-    FileAssetImporter(FileAsset*, FileAssetLoader*, Factory*);
+    FileAssetImporter(FileAsset*, FileAssetLoader*, Factory*, ImageBudget* = nullptr);
     void onFileAssetContents(std::unique_ptr<FileAssetContents> contents);
     StatusCode resolve() override;
 };
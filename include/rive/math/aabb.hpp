@@ -123,6 +123,12 @@ public:
     }
 
     bool contains(Vec2D position) const;
+
+    /// Returns true if the two AABBs overlap (touching edges don't count).
+    bool intersects(const AABB& o) const
+    {
+        return minX < o.maxX && o.minX < maxX && minY < o.maxY && o.minY < maxY;
+    }
 };
 
 } // namespace rive
@@ -35,8 +35,15 @@ public:
         void extract(RawPath* dst, const Vec2D pts[]) const;
     };
 
+    struct PosTan
+    {
+        Vec2D pos, tan;
+    };
+
 private:
     size_t findSegment(float distance) const;
+    size_t findSegment(float distance, size_t hint) const;
+    PosTan evalSegment(size_t index, float distance) const;
 
     std::vector<Segment> m_segments;
     std::vector<Vec2D> m_points;
@@ -51,12 +58,13 @@ public:
     float length() const { return m_length; }
     bool isClosed() const { return m_isClosed; }
 
-    struct PosTan
-    {
-        Vec2D pos, tan;
-    };
     PosTan getPosTan(float distance) const;
 
+    // Same as getPosTan, but starts the segment search at *segmentCursor and
+    // writes the found segment back to it. Sequential lookups (like an object
+    // moving along a path) usually hit the same or the next segment.
+    PosTan getPosTan(float distance, size_t* segmentCursor) const;
+
     void getSegment(float startDistance, float endDistance, RawPath* dst, bool startWithMove) const;
 
     Vec2D warp(Vec2D src) const
@@ -0,0 +1,31 @@
+#ifndef _RIVE_DECOMPOSE_CACHE_HPP_
+#define _RIVE_DECOMPOSE_CACHE_HPP_
+
+#include "rive/math/mat2d.hpp"
+#include "rive/math/transform_components.hpp"
+
+namespace rive
+{
+/// Remembers the last matrix it decomposed so that transforms which didn't
+/// change since the previous frame skip the atan2/sqrt work.
+class DecomposeCache
+{
+public:
+    const TransformComponents& decompose(const Mat2D& transform)
+    {
+        if (!m_isValid || transform != m_transform)
+        {
+            m_transform = transform;
+            m_components = transform.decompose();
+            m_isValid = true;
+        }
+        return m_components;
+    }
+
+private:
+    Mat2D m_transform;
+    TransformComponents m_components;
+    bool m_isValid = false;
+};
+} // namespace rive
+#endif
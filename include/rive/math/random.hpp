@@ -0,0 +1,47 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#ifndef _RIVE_RANDOM_HPP_
+#define _RIVE_RANDOM_HPP_
+
+#include "rive/rive_types.hpp"
+#include <stdint.h>
+
+namespace rive
+{
+// Small, fast PCG32 (XSH-RR variant) pseudo random number generator. Each
+// instance owns its state so it's safe to use one per object across threads
+// and the sequence is fully reproducible from the seed.
+class Random
+{
+public:
+    Random() { seed(0); }
+    explicit Random(uint64_t seedValue) { seed(seedValue); }
+
+    void seed(uint64_t seedValue)
+    {
+        m_state = 0;
+        nextU32();
+        m_state += seedValue;
+        nextU32();
+    }
+
+    uint32_t nextU32()
+    {
+        uint64_t oldState = m_state;
+        m_state = oldState * 6364136223846793005ULL + kIncrement;
+        uint32_t xorShifted = (uint32_t)(((oldState >> 18u) ^ oldState) >> 27u);
+        uint32_t rot = (uint32_t)(oldState >> 59u);
+        return (xorShifted >> rot) | (xorShifted << ((0u - rot) & 31u));
+    }
+
+    // Returns a value in [0, 1).
+    double nextDouble() { return nextU32() * (1.0 / 4294967296.0); }
+
+private:
+    static constexpr uint64_t kIncrement = 1442695040888963407ULL;
+    uint64_t m_state;
+};
+} // namespace rive
+#endif
@@ -47,6 +47,12 @@ public:
     // Makes the path empty but keeps the memory for the drawing calls reserved.
     void rewind();
 
+    // Bytes reserved for points and verbs.
+    size_t byteSize() const
+    {
+        return m_Points.capacity() * sizeof(Vec2D) + m_Verbs.capacity() * sizeof(PathVerb);
+    }
+
     RawPath transform(const Mat2D&) const;
     void transformInPlace(const Mat2D&);
 
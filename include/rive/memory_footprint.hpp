@@ -0,0 +1,65 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#ifndef _RIVE_MEMORY_FOOTPRINT_HPP_
+#define _RIVE_MEMORY_FOOTPRINT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rive
+{
+class Core;
+
+/// Bytes of memory used by a File or an ArtboardInstance, by category. Built
+/// by walking the object graph, each object adding itself and whatever it
+/// owns through Core::addMemoryFootprint. Sizes are what the runtime holds
+/// on the CPU (containers are counted by capacity), render objects only add
+/// what their backend reports (RenderBuffer sizes, CommandPath::byteSize).
+struct MemoryFootprint
+{
+    /// Core objects (components, animations, state machines, assets) and
+    /// their bookkeeping.
+    size_t coreObjects = 0;
+    /// Keyframes and the containers holding them.
+    size_t keyframes = 0;
+    /// Path and mesh vertices, mesh indices and vertex render buffers.
+    size_t vertexData = 0;
+    /// Path data cached for rendering, trimming and following paths.
+    size_t renderPaths = 0;
+    /// Decoded images (estimated from their headers until decoded).
+    size_t images = 0;
+    /// Loaded fonts.
+    size_t fonts = 0;
+    /// Shaped glyph runs, line breaks and text kept for re-shaping.
+    size_t textShaping = 0;
+
+    size_t total() const
+    {
+        return coreObjects + keyframes + vertexData + renderPaths + images + fonts + textShaping;
+    }
+
+    /// Size of object's concrete type.
+    static size_t objectSize(const Core* object);
+
+    template <typename Container> static size_t capacityBytes(const Container& container)
+    {
+        return container.capacity() * sizeof(typename Container::value_type);
+    }
+
+    MemoryFootprint& operator+=(const MemoryFootprint& other)
+    {
+        coreObjects += other.coreObjects;
+        keyframes += other.keyframes;
+        vertexData += other.vertexData;
+        renderPaths += other.renderPaths;
+        images += other.images;
+        fonts += other.fonts;
+        textShaping += other.textShaping;
+        return *this;
+    }
+};
+} // namespace rive
+
+#endif
@@ -4,6 +4,7 @@
 #include "rive/generated/nested_artboard_base.hpp"
 #include "rive/hit_info.hpp"
 #include "rive/span.hpp"
+#include <memory>
 #include <stdio.h>
 
 namespace rive
@@ -16,7 +17,25 @@ class NestedArtboard : public NestedArtboardBase
 private:
     Artboard* m_Artboard = nullptr;               // might point to m_Instance, and might not
     std::unique_ptr<ArtboardInstance> m_Instance; // may be null
+    std::shared_ptr<ArtboardInstance> m_SharedInstance; // may be null
+    Artboard* m_SharedSource = nullptr; // source of m_SharedInstance
     std::vector<NestedAnimation*> m_NestedAnimations;
+    // Time skipped while throttled off screen.
+    float m_OffscreenElapsedSeconds = 0.0f;
+
+    // True when neither this nor anything nested within it has nested
+    // animations (so its instance never needs to advance), audio events or
+    // text modifiers (which change state while drawing). Such nests can
+    // share a read only instance.
+    bool isStatic() const;
+
+    // Swaps the shared instance for a private one, for when this nest needs
+    // to change it (e.g. to draw at a different opacity).
+    void unshare();
+
+    // Passes the parent's viewport (and offscreen advance policy) down into
+    // the nested instance's space.
+    void updateViewport();
 
 public:
     NestedArtboard();
@@ -27,13 +46,24 @@ public:
     void addNestedAnimation(NestedAnimation* nestedAnimation);
 
     void nest(Artboard* artboard);
+    /// Nests source's shared instance, returns false if it couldn't be made.
+    bool nestShared(Artboard* source);
 
-    ArtboardInstance* artboard() { return m_Instance.get(); }
+    ArtboardInstance* artboard()
+    {
+        return m_Instance != nullptr ? m_Instance.get() : m_SharedInstance.get();
+    }
+    bool isSharedInstance() const { return m_SharedInstance != nullptr; }
 
     StatusCode import(ImportStack& importStack) override;
     Core* clone() const override;
     bool advance(float elapsedSeconds);
     void update(ComponentDirt value) override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
+
+    /// Returns false when the artboard this is nested in has a viewport and
+    /// this nested artboard's (clipped) bounds are entirely outside of it.
+    bool isInViewport() const;
 
     bool hasNestedStateMachines() const;
     Span<NestedAnimation*> nestedAnimations();
@@ -0,0 +1,80 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#ifndef _RIVE_RECORDING_RENDERER_HPP_
+#define _RIVE_RECORDING_RENDERER_HPP_
+
+#include "rive/renderer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace rive
+{
+/// Renderer that records every call into a display list which can later be
+/// replayed onto any other Renderer. Commands are packed into arena blocks
+/// that are reused across clear() calls, so re-recording a frame of similar
+/// size doesn't allocate.
+///
+/// Paths, paints, images and buffers are retained (not copied), replay sees
+/// their state at replay time. An artboard can be recorded on a worker thread
+/// and replayed on the render thread as long as it doesn't advance in between,
+/// and a recording of an unchanged artboard can be replayed any number of
+/// times without drawing the artboard again.
+class RecordingRenderer : public Renderer
+{
+public:
+    RecordingRenderer();
+    ~RecordingRenderer() override;
+
+    RecordingRenderer(RecordingRenderer&&);
+    RecordingRenderer& operator=(RecordingRenderer&&);
+    RecordingRenderer(const RecordingRenderer&) = delete;
+    RecordingRenderer& operator=(const RecordingRenderer&) = delete;
+
+    /// Issues every recorded command, in order, to renderer.
+    void replay(Renderer* renderer) const;
+
+    /// Drops all commands (releasing their references) but keeps the arena.
+    void clear();
+
+    bool empty() const { return m_commandCount == 0; }
+    size_t commandCount() const { return m_commandCount; }
+    /// Bytes of arena in use by commands.
+    size_t byteSize() const;
+
+    void save() override;
+    void restore() override;
+    void transform(const Mat2D& transform) override;
+    void drawPath(RenderPath* path, RenderPaint* paint) override;
+    void clipPath(RenderPath* path) override;
+    void drawImage(const RenderImage*, BlendMode, float opacity) override;
+    void drawImageMesh(const RenderImage*,
+                       rcp<RenderBuffer> vertices_f32,
+                       rcp<RenderBuffer> uvCoords_f32,
+                       rcp<RenderBuffer> indices_u16,
+                       uint32_t vertexCount,
+                       uint32_t indexCount,
+                       BlendMode,
+                       float opacity) override;
+
+private:
+    struct Block
+    {
+        std::unique_ptr<uint8_t[]> bytes;
+        size_t capacity;
+        size_t used;
+    };
+
+    template <typename T> T* allocate();
+
+    std::vector<Block> m_blocks;
+    // Index of the block currently being appended to.
+    size_t m_currentBlock = 0;
+    size_t m_commandCount = 0;
+};
+} // namespace rive
+#endif
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#ifndef _RIVE_RUNTIME_STATS_HPP_
+#define _RIVE_RUNTIME_STATS_HPP_
+
+#include <cstdint>
+
+namespace rive
+{
+/// Counters the runtime bumps as it works, cheap enough to always be on.
+/// They accumulate until reset, so reading and resetting them once per frame
+/// gives per frame numbers. Artboards count their own work (nested artboards
+/// count into their own instance), state machines count transitions and hit
+/// tests.
+struct RuntimeStats
+{
+    /// Components whose update() ran in Artboard::updateComponents.
+    uint32_t componentsUpdated = 0;
+    /// Paths whose command path was rebuilt.
+    uint32_t pathsRebuilt = 0;
+    /// Texts shaped (including shaping only to compute modifier coverage).
+    uint32_t textShapes = 0;
+
+    /// Render objects requested from the Factory.
+    uint32_t renderPathsCreated = 0;
+    uint32_t renderPaintsCreated = 0;
+    uint32_t shadersCreated = 0;
+    uint32_t renderBuffersCreated = 0;
+    /// Bytes of the render buffers above.
+    uint64_t renderBufferBytes = 0;
+
+    /// State changes across all layers (entering the entry state included).
+    uint32_t stateTransitions = 0;
+    /// Listener shapes and nested artboards tested against pointer events.
+    uint32_t hitTests = 0;
+
+    void reset() { *this = RuntimeStats(); }
+
+    RuntimeStats& operator+=(const RuntimeStats& other)
+    {
+        componentsUpdated += other.componentsUpdated;
+        pathsRebuilt += other.pathsRebuilt;
+        textShapes += other.textShapes;
+        renderPathsCreated += other.renderPathsCreated;
+        renderPaintsCreated += other.renderPaintsCreated;
+        shadersCreated += other.shadersCreated;
+        renderBuffersCreated += other.renderBuffersCreated;
+        renderBufferBytes += other.renderBufferBytes;
+        stateTransitions += other.stateTransitions;
+        hitTests += other.hitTests;
+        return *this;
+    }
+};
+} // namespace rive
+
+#endif
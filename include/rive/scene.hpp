@@ -32,6 +32,7 @@ public:
     float width() const;
     float height() const;
     AABB bounds() const { return {0, 0, this->width(), this->height()}; }
+    ArtboardInstance* artboardInstance() const { return m_artboardInstance; }
 
     virtual std::string name() const = 0;
 
@@ -30,6 +30,9 @@ public:
     void update(ComponentDirt value) override;
 
     RenderPath* renderPath() const { return m_ClipRenderPath; }
+
+    /// World bounds of the clipping region, false if there isn't one.
+    bool worldBounds(AABB* bounds) const;
 };
 } // namespace rive
 
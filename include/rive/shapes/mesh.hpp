@@ -38,6 +38,7 @@ public:
     void updateVertexRenderBuffer(Renderer* renderer);
     void markSkinDirty() override;
     Core* clone() const override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
 
     /// Initialize the any buffers that will be shared amongst instances (the
     /// instance are guaranteed to use the same RenderImage).
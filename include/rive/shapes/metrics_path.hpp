@@ -41,6 +41,8 @@ public:
     RawPath::Iter addToRawPath(RawPath& rawPath, const Mat2D& transform) const;
     ~MetricsPath() override;
 
+    size_t byteSize() const override;
+
 private:
     float computeLength(const Mat2D& transform);
 };
@@ -67,6 +69,7 @@ public:
     RenderMetricsPath(rcp<RenderPath>);
     RenderPath* renderPath() override { return m_RenderPath.get(); }
     void addPath(CommandPath* path, const Mat2D& transform) override;
+    size_t byteSize() const override;
 
     void fillRule(FillRule value) override;
     void rewind() override;
@@ -21,6 +21,7 @@ public:
     void endChanged() override;
     void offsetChanged() override;
     void modeValueChanged() override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
 };
 } // namespace rive
 
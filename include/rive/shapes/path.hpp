@@ -54,10 +54,12 @@ public:
     void addDefaultPathSpace(PathSpace space);
     bool canDeferPathUpdate();
     void addVertex(PathVertex* vertex);
+    size_t vertexCount() const { return m_Vertices.size(); }
 
     virtual void markPathDirty();
     virtual bool isPathClosed() const { return true; }
     void onDirty(ComponentDirt dirt) override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
     inline bool isHidden() const { return (pathFlags() & 0x1) == 0x1; }
 #ifdef ENABLE_QUERY_FLAT_VERTICES
     FlattenedPath* makeFlat(bool transformToParent);
@@ -63,6 +63,9 @@ public:
 
     AABB computeWorldBounds(const Mat2D* xform = nullptr) const;
     AABB computeLocalBounds() const;
+
+    bool drawBounds(AABB* bounds) override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
 };
 } // namespace rive
 
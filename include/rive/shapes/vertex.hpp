@@ -18,6 +18,7 @@ public:
     virtual void deform(const Mat2D& worldTransform, const float* boneTransforms);
     bool hasWeight() { return m_Weight != nullptr; }
     Vec2D renderTranslation();
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
 
 protected:
     virtual void markGeometryDirty() = 0;
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#ifndef _RIVE_SPSC_QUEUE_HPP_
+#define _RIVE_SPSC_QUEUE_HPP_
+
+#include "rive/rive_types.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+namespace rive
+{
+// Fixed capacity, lock-free queue for exactly one producer thread and one
+// consumer thread. Neither side ever blocks or allocates, which makes it safe
+// to push from real-time threads (like an audio callback).
+template <typename T, size_t Capacity> class SPSCQueue
+{
+    static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0,
+                  "SPSCQueue capacity must be a power of two");
+
+public:
+    // Producer side. Returns false (and leaves the queue untouched) if full.
+    bool push(const T& value)
+    {
+        size_t head = m_head.value.load(std::memory_order_relaxed);
+        if (head - m_tail.value.load(std::memory_order_acquire) == Capacity)
+        {
+            return false;
+        }
+        m_items[head & (Capacity - 1)] = value;
+        m_head.value.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Producer side.
+    bool full() const
+    {
+        size_t head = m_head.value.load(std::memory_order_relaxed);
+        return head - m_tail.value.load(std::memory_order_acquire) == Capacity;
+    }
+
+    // Consumer side. Returns false if there was nothing to pop.
+    bool pop(T& value)
+    {
+        size_t tail = m_tail.value.load(std::memory_order_relaxed);
+        if (tail == m_head.value.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        value = m_items[tail & (Capacity - 1)];
+        m_tail.value.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side.
+    bool empty() const
+    {
+        size_t tail = m_tail.value.load(std::memory_order_relaxed);
+        return tail == m_head.value.load(std::memory_order_acquire);
+    }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    // Keep the producer and consumer indices on separate cache lines.
+    struct PaddedIndex
+    {
+        std::atomic<size_t> value{0};
+        char padding[64 - sizeof(std::atomic<size_t>)];
+    };
+
+    PaddedIndex m_head;
+    PaddedIndex m_tail;
+    T m_items[Capacity];
+};
+} // namespace rive
+#endif
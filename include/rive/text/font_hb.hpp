@@ -30,6 +30,7 @@ public:
                                 rive::Span<const Feature> features) const override;
 
     bool hasGlyph(rive::Span<const rive::Unichar>) const override;
+    size_t byteSize() const override;
 
     static rive::rcp<rive::Font> Decode(rive::Span<const uint8_t>);
     hb_font_t* font() const { return m_font; }
@@ -21,6 +21,7 @@ public:
 
     bool empty() const { return m_glyphIndices.empty(); }
     void clear() { m_glyphIndices.clear(); }
+    size_t byteSize() const { return m_glyphIndices.capacity() * sizeof(uint32_t); }
 };
 } // namespace rive
 
@@ -54,6 +54,11 @@ public:
     const std::vector<TextRun>& runs() const { return m_runs; }
 
     void swapRuns(std::vector<TextRun>& otherRuns) { m_runs.swap(otherRuns); }
+
+    size_t byteSize() const
+    {
+        return m_value.capacity() * sizeof(Unichar) + m_runs.capacity() * sizeof(TextRun);
+    }
 };
 
 // STL-style iterator for individual glyphs in a line, simplfies call sites from
@@ -114,6 +119,7 @@ public:
     const GlyphRun* startLogical() const { return m_startLogical; }
     const GlyphRun* endLogical() const { return m_endLogical; }
     const std::vector<const GlyphRun*>& runs() const { return m_runs; }
+    size_t byteSize() const { return sizeof(OrderedLine) + m_runs.capacity() * sizeof(GlyphRun*); }
 
     GlyphItr begin() const
     {
@@ -168,6 +174,7 @@ class Text : public TextBase
 public:
     void draw(Renderer* renderer) override;
     Core* hitTest(HitInfo*, const Mat2D&) override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
     void addRun(TextValueRun* run);
     void addModifierGroup(TextModifierGroup* group);
     void markShapeDirty();
@@ -189,6 +196,9 @@ public:
     const std::vector<TextValueRun*>& runs() const { return m_runs; }
 #endif
 
+    /// Number of glyphs shaped for display (0 until the text updates).
+    size_t glyphCount() const;
+
     bool haveModifiers() const
     {
 #ifdef WITH_RIVE_TEXT
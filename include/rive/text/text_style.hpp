@@ -43,6 +43,7 @@ public:
     void updateVariableFont();
     StatusCode onAddedClean(CoreContext* context) override;
     void onDirty(ComponentDirt dirt) override;
+    void addMemoryFootprint(MemoryFootprint& footprint) const override;
 
 protected:
     void fontSizeChanged() override;
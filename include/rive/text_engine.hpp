@@ -160,6 +160,10 @@ public:
     //
     virtual RawPath getPath(GlyphID) const = 0;
 
+    // Bytes of font data held in memory, 0 when unknown. Fonts made with
+    // withOptions() share their data with the font they were made from.
+    virtual size_t byteSize() const { return 0; }
+
     SimpleArray<Paragraph> shapeText(Span<const Unichar> text, Span<const TextRun> runs) const;
 
     // If the platform can supply fallback font(s), set this function pointer.
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#ifndef _RIVE_TRACE_HPP_
+#define _RIVE_TRACE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rive
+{
+/// One completed trace scope.
+struct TraceEvent
+{
+    static constexpr size_t maxObjectLength = 47;
+
+    /// Static string naming the traced function.
+    const char* name;
+    /// Nanoseconds since Trace::start().
+    uint64_t startNs;
+    uint64_t durationNs;
+    /// Index of the thread that recorded the event, in the order threads
+    /// first recorded one.
+    uint32_t threadId;
+    /// Name of the artboard or component the scope was working on (truncated).
+    char object[maxObjectLength + 1];
+};
+
+/// Records hot path scopes (marked with RIVE_TRACE_SCOPE) while active. Each
+/// thread writes into its own fixed size ring buffer without locking, so a
+/// long capture keeps the most recent events of every thread.
+///
+/// Markers are only compiled in when WITH_RIVE_TRACING is defined. Compiled
+/// out they cost nothing, compiled in but inactive they cost a relaxed
+/// atomic load.
+class Trace
+{
+public:
+    /// True when markers are compiled in.
+    static bool compiledIn();
+
+    /// Drops any previous capture and starts recording, keeping up to
+    /// eventsPerThread events in each thread's ring buffer.
+    static void start(size_t eventsPerThread = 1 << 16);
+    static void stop();
+    static bool active() { return s_active.load(std::memory_order_relaxed); }
+
+    /// Stops recording and frees every thread's ring buffer (a capture keeps
+    /// them allocated, eventsPerThread * sizeof(TraceEvent) bytes each, until
+    /// the next start or release). Buffers of threads that have exited are
+    /// dropped entirely. Only call while no traced scopes are running.
+    static void release();
+    /// Bytes held by the ring buffers of every thread that has traced.
+    static size_t bufferedBytes();
+
+    /// Events recorded since start(), ordered by start time. Call after
+    /// stop(), or expect to miss events being recorded while collecting.
+    static std::vector<TraceEvent> events();
+
+    /// Events in the Chrome trace event JSON format, which
+    /// chrome://tracing and ui.perfetto.dev open directly.
+    static std::string chromeJson();
+    static std::string chromeJson(const std::vector<TraceEvent>& events);
+
+    static uint64_t nowNs();
+    static void record(const char* name,
+                       uint64_t startNs,
+                       uint64_t endNs,
+                       const std::string* object);
+
+private:
+    static std::atomic<bool> s_active;
+};
+
+/// Records the time between its construction and destruction when tracing is
+/// active. Use through RIVE_TRACE_SCOPE.
+class TraceScope
+{
+public:
+    TraceScope(const char* name, const std::string* object = nullptr)
+    {
+        if (Trace::active())
+        {
+            m_name = name;
+            m_object = object;
+            m_startNs = Trace::nowNs();
+        }
+    }
+
+    ~TraceScope()
+    {
+        if (m_name != nullptr)
+        {
+            Trace::record(m_name, m_startNs, Trace::nowNs(), m_object);
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* m_name = nullptr;
+    const std::string* m_object = nullptr;
+    uint64_t m_startNs = 0;
+};
+} // namespace rive
+
+#ifdef WITH_RIVE_TRACING
+#define RIVE_TRACE_CONCAT_(a, b) a##b
+#define RIVE_TRACE_CONCAT(a, b) RIVE_TRACE_CONCAT_(a, b)
+/// Traces the rest of the enclosing scope as name (a string literal).
+#define RIVE_TRACE_SCOPE(name) rive::TraceScope RIVE_TRACE_CONCAT(riveTrace, __LINE__)(name)
+/// Same as RIVE_TRACE_SCOPE, tagged with object (a std::string that must
+/// outlive the scope), usually an artboard or component name.
+#define RIVE_TRACE_SCOPE_OBJECT(name, object)                                                      \
+    rive::TraceScope RIVE_TRACE_CONCAT(riveTrace, __LINE__)(name, &(object))
+#else
+#define RIVE_TRACE_SCOPE(name)
+#define RIVE_TRACE_SCOPE_OBJECT(name, object)
+#endif
+
+#endif
@@ -8,6 +8,10 @@ filter({ 'options:with_rive_text' })
 do
     defines({ 'WITH_RIVE_TEXT' })
 end
+filter({ 'options:with_rive_tracing' })
+do
+    defines({ 'WITH_RIVE_TRACING' })
+end
 filter({ 'options:with_rive_audio=system' })
 do
     defines({ 'WITH_RIVE_AUDIO', 'MA_NO_RESOURCE_MANAGER' })
@@ -151,6 +155,11 @@ newoption({
     description = 'Compiles in text features.',
 })
 
+newoption({
+    trigger = 'with_rive_tracing',
+    description = 'Compiles in trace markers on hot paths (see rive/trace.hpp).',
+})
+
 newoption({
     trigger = 'with_rive_audio',
     value = 'disabled',
@@ -7,7 +7,18 @@
 #include "rive/animation/linear_animation_instance.hpp"
 #include "rive/animation/state_machine_instance.hpp"
 #include "rive/animation/state_machine_input_instance.hpp"
+#include "rive/assets/image_asset.hpp"
+#include "rive/generated/core_registry.hpp"
+#include "rive/nested_artboard.hpp"
+#include "rive/shapes/clipping_shape.hpp"
+#include "rive/shapes/path.hpp"
+#include "rive/static_scene.hpp"
+#include "rive/text/text.hpp"
 #include "utils/no_op_factory.hpp"
+#include "utils/no_op_renderer.hpp"
+
+#include <chrono>
+#include <map>
 
 class JSoner
 {
@@ -61,7 +72,7 @@ public:
     void pop()
     {
         assert(!m_IsArray.empty());
-        char c = m_IsArray.front() ? ']' : '}';
+        char c = m_IsArray.back() ? ']' : '}';
         m_IsArray.pop_back();
 
         this->tab();
@@ -69,10 +80,266 @@ public:
     }
 
     void add(const char key[], int value) { this->add(key, std::to_string(value).c_str()); }
+    void add(const char key[], size_t value) { this->add(key, std::to_string(value).c_str()); }
+    void add(const char key[], double value) { this->add(key, std::to_string(value).c_str()); }
 };
 
 //////////////////////////////////////////////////
 
+// Settings for the --cost profile. Remembers whether anything went over a
+// --limit so the run can fail, letting asset pipelines gate on it.
+class CostReport
+{
+    std::vector<std::pair<std::string, double>> m_limits;
+    bool m_exceeded = false;
+
+public:
+    int frames = 120;
+
+    // The metrics --limit accepts.
+    static bool isMetric(const std::string& key)
+    {
+        static const char* metrics[] = {
+            "components",
+            "pathVertices",
+            "pathVerbs",
+            "keyframes",
+            "clippingShapes",
+            "nestedArtboards",
+            "nestedDepth",
+            "nestedFanOut",
+            "textGlyphs",
+            "advanceUs",
+            "drawUs",
+            "assetBytes",
+        };
+        for (auto metric : metrics)
+        {
+            if (key == metric)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Parses "metric=value".
+    bool addLimit(const char arg[])
+    {
+        const char* equals = strchr(arg, '=');
+        if (equals == nullptr)
+        {
+            return false;
+        }
+        std::string key(arg, equals - arg);
+        char* end = nullptr;
+        double value = strtod(equals + 1, &end);
+        if (!isMetric(key) || end == equals + 1 || *end != '\0')
+        {
+            return false;
+        }
+        m_limits.push_back({key, value});
+        return true;
+    }
+
+    void check(const std::string& scope, const char metric[], double value)
+    {
+        for (const auto& limit : m_limits)
+        {
+            if (limit.first == metric && value > limit.second)
+            {
+                fprintf(stderr,
+                        "%s: %s is %g, over the limit of %g\n",
+                        scope.c_str(),
+                        metric,
+                        value,
+                        limit.second);
+                m_exceeded = true;
+            }
+        }
+    }
+
+    bool exceeded() const { return m_exceeded; }
+};
+
+// Counts the verbs a path builds.
+class VerbCounter : public rive::CommandPath
+{
+public:
+    size_t verbs = 0;
+
+    void rewind() override {}
+    void fillRule(rive::FillRule value) override {}
+    void addPath(rive::CommandPath* path, const rive::Mat2D& transform) override {}
+    void moveTo(float x, float y) override { verbs++; }
+    void lineTo(float x, float y) override { verbs++; }
+    void cubicTo(float ox, float oy, float ix, float iy, float x, float y) override { verbs++; }
+    void close() override { verbs++; }
+    rive::RenderPath* renderPath() override { return nullptr; }
+};
+
+struct NestedCost
+{
+    size_t count = 0;
+    size_t depth = 0;
+    size_t fanOut = 0;
+};
+
+static void measureNesting(rive::Artboard* artboard, size_t depth, NestedCost& cost)
+{
+    const auto& nestedArtboards = artboard->nestedArtboards();
+    cost.fanOut = std::max(cost.fanOut, nestedArtboards.size());
+    for (auto nestedArtboard : nestedArtboards)
+    {
+        cost.count++;
+        cost.depth = std::max(cost.depth, depth + 1);
+        if (auto nested = nestedArtboard->artboard())
+        {
+            measureNesting(nested, depth + 1, cost);
+        }
+    }
+}
+
+// Counts are of the artboard's own objects, nested artboards only add to the
+// nesting metrics (and to the measured times).
+static void dumpCost(JSoner& js, CostReport& report, rive::ArtboardInstance* abi)
+{
+    // Builds parametric paths and shapes text.
+    abi->advance(0.0f);
+
+    std::map<std::string, size_t> components;
+    size_t componentCount = 0;
+    size_t pathVertices = 0, pathVerbs = 0, clippingShapes = 0, textGlyphs = 0;
+    for (auto object : abi->objects())
+    {
+        if (object == nullptr)
+        {
+            continue;
+        }
+        componentCount++;
+        auto name = rive::CoreRegistry::objectName(object->coreType());
+        components[name != nullptr ? name : std::to_string(object->coreType())]++;
+        if (object->is<rive::Path>())
+        {
+            auto path = object->as<rive::Path>();
+            VerbCounter counter;
+            path->buildPath(counter);
+            pathVertices += path->vertexCount();
+            pathVerbs += counter.verbs;
+        }
+        else if (object->is<rive::ClippingShape>())
+        {
+            clippingShapes++;
+        }
+        else if (object->is<rive::Text>())
+        {
+            textGlyphs += object->as<rive::Text>()->glyphCount();
+        }
+    }
+    NestedCost nested;
+    measureNesting(abi, 0, nested);
+
+    // Times the default scene (state machine, else animation, else the bare
+    // artboard) advancing and drawing at 60fps.
+    auto scene = abi->defaultScene();
+    if (!scene)
+    {
+        scene = std::make_unique<rive::StaticScene>(abi);
+    }
+    rive::NoOpRenderer renderer;
+    std::chrono::steady_clock::duration advanceTime(0), drawTime(0);
+    for (int i = 0; i < report.frames; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        scene->advanceAndApply(1.0f / 60.0f);
+        auto advanced = std::chrono::steady_clock::now();
+        scene->draw(&renderer);
+        auto drawn = std::chrono::steady_clock::now();
+        advanceTime += advanced - start;
+        drawTime += drawn - advanced;
+    }
+    auto averageUs = [&](std::chrono::steady_clock::duration total) {
+        return report.frames > 0
+                   ? std::chrono::duration<double, std::micro>(total).count() / report.frames
+                   : 0.0;
+    };
+
+    js.pushStruct("cost");
+    js.add("components", componentCount);
+    js.pushStruct("componentTypes");
+    for (const auto& itr : components)
+    {
+        js.add(itr.first.c_str(), itr.second);
+    }
+    js.pop();
+    js.add("pathVertices", pathVertices);
+    js.add("pathVerbs", pathVerbs);
+    size_t keyframes = 0;
+    if (auto count = abi->animationCount())
+    {
+        js.pushArray("animationKeyframes");
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto animation = abi->animation(i);
+            js.pushStruct();
+            js.add("name", animation->name().c_str());
+            js.add("keyframes", animation->keyFrameCount());
+            js.pop();
+            keyframes += animation->keyFrameCount();
+        }
+        js.pop();
+    }
+    js.add("keyframes", keyframes);
+    js.add("clippingShapes", clippingShapes);
+    js.add("nestedArtboards", nested.count);
+    js.add("nestedDepth", nested.depth);
+    js.add("nestedFanOut", nested.fanOut);
+    js.add("textGlyphs", textGlyphs);
+    js.add("advanceUs", averageUs(advanceTime));
+    js.add("drawUs", averageUs(drawTime));
+    js.pop();
+
+    const std::string& scope = abi->name();
+    report.check(scope, "components", componentCount);
+    report.check(scope, "pathVertices", pathVertices);
+    report.check(scope, "pathVerbs", pathVerbs);
+    report.check(scope, "keyframes", keyframes);
+    report.check(scope, "clippingShapes", clippingShapes);
+    report.check(scope, "nestedArtboards", nested.count);
+    report.check(scope, "nestedDepth", nested.depth);
+    report.check(scope, "nestedFanOut", nested.fanOut);
+    report.check(scope, "textGlyphs", textGlyphs);
+    report.check(scope, "advanceUs", averageUs(advanceTime));
+    report.check(scope, "drawUs", averageUs(drawTime));
+}
+
+static void dumpAssets(JSoner& js, CostReport& report, rive::File* file)
+{
+    size_t assetBytes = 0;
+    js.pushArray("assets");
+    for (auto asset : file->assets())
+    {
+        js.pushStruct();
+        js.add("name", asset->name().c_str());
+        js.add("type", rive::CoreRegistry::objectName(asset->coreType()));
+        js.add("embeddedBytes", asset->embeddedSize());
+        if (asset->is<rive::ImageAsset>())
+        {
+            const auto& header = asset->as<rive::ImageAsset>()->imageHeader();
+            js.add("width", (size_t)header.width);
+            js.add("height", (size_t)header.height);
+            js.add("decodedBytes", header.decodedByteSize());
+        }
+        js.pop();
+        assetBytes += asset->embeddedSize();
+    }
+    js.pop();
+    js.add("assetBytes", assetBytes);
+    report.check("file", "assetBytes", assetBytes);
+}
+
+//////////////////////////////////////////////////
+
 static void dump(JSoner& js, rive::LinearAnimationInstance* anim)
 {
     js.pushStruct();
@@ -99,10 +366,26 @@ static void dump(JSoner& js, rive::StateMachineInstance* smi)
     js.pop();
 }
 
-static void dump(JSoner& js, rive::ArtboardInstance* abi)
+static void dump(JSoner& js, const rive::MemoryFootprint& footprint)
+{
+    js.pushStruct("memory");
+    js.add("total", footprint.total());
+    js.add("coreObjects", footprint.coreObjects);
+    js.add("keyframes", footprint.keyframes);
+    js.add("vertexData", footprint.vertexData);
+    js.add("renderPaths", footprint.renderPaths);
+    js.add("images", footprint.images);
+    js.add("fonts", footprint.fonts);
+    js.add("textShaping", footprint.textShaping);
+    js.pop();
+}
+
+static void dump(JSoner& js, rive::ArtboardInstance* abi, CostReport* cost)
 {
     js.pushStruct();
     js.add("name", abi->name().c_str());
+    // What each additional instance of this artboard costs.
+    dump(js, abi->memoryFootprint());
     if (auto count = abi->animationCount())
     {
         js.pushArray("animations");
@@ -121,16 +404,25 @@ static void dump(JSoner& js, rive::ArtboardInstance* abi)
         }
         js.pop();
     }
+    if (cost != nullptr)
+    {
+        dumpCost(js, *cost, abi);
+    }
     js.pop();
 }
 
-static void dump(JSoner& js, rive::File* file)
+static void dump(JSoner& js, rive::File* file, CostReport* cost)
 {
+    dump(js, file->memoryFootprint());
+    if (cost != nullptr)
+    {
+        dumpAssets(js, *cost, file);
+    }
     auto count = file->artboardCount();
     js.pushArray("artboards");
     for (size_t i = 0; i < count; ++i)
     {
-        dump(js, file->artboardAt(i).get());
+        dump(js, file->artboardAt(i).get(), cost);
     }
     js.pop();
 }
@@ -161,12 +453,14 @@ static std::unique_ptr<rive::File> open_file(const char name[])
 
 static bool is_arg(const char arg[], const char target[], const char alt[] = nullptr)
 {
-    return !strcmp(arg, target) || (arg && !strcmp(arg, alt));
+    return !strcmp(arg, target) || (alt && !strcmp(arg, alt));
 }
 
 int main(int argc, const char* argv[])
 {
     const char* filename = nullptr;
+    bool costProfile = false;
+    CostReport cost;
 
     for (int i = 1; i < argc; ++i)
     {
@@ -175,6 +469,26 @@ int main(int argc, const char* argv[])
             filename = argv[++i];
             continue;
         }
+        if (is_arg(argv[i], "--cost", "-c"))
+        {
+            costProfile = true;
+            continue;
+        }
+        if (is_arg(argv[i], "--frames", "-n") && i + 1 < argc)
+        {
+            cost.frames = atoi(argv[++i]);
+            continue;
+        }
+        if (is_arg(argv[i], "--limit", "-l") && i + 1 < argc)
+        {
+            if (!cost.addLimit(argv[++i]))
+            {
+                printf("Bad limit %s, expected metric=value\n", argv[i]);
+                return 1;
+            }
+            costProfile = true;
+            continue;
+        }
         printf("Unrecognized argument %s\n", argv[i]);
         return 1;
     }
@@ -192,8 +506,11 @@ int main(int argc, const char* argv[])
         return 1;
     }
 
-    JSoner js;
-    js.pushStruct();
-    dump(js, file.get());
-    return 0;
+    {
+        JSoner js;
+        js.pushStruct();
+        dump(js, file.get(), costProfile ? &cost : nullptr);
+    }
+    // Distinct from failing to run so pipelines can tell the two apart.
+    return cost.exceeded() ? 2 : 0;
 }
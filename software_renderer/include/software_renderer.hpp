@@ -0,0 +1,115 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#ifndef _RIVE_SOFTWARE_RENDERER_HPP_
+#define _RIVE_SOFTWARE_RENDERER_HPP_
+
+#include "rive/factory.hpp"
+#include "rive/renderer.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace rive
+{
+namespace software
+{
+struct ClipState;
+struct DrawCommand;
+} // namespace software
+
+/// Factory for the headless CPU renderer. Paths, paints, gradients, buffers
+/// and images it makes can only be drawn with a SoftwareRenderer.
+class SoftwareFactory : public Factory
+{
+public:
+    rcp<RenderBuffer> makeRenderBuffer(RenderBufferType, RenderBufferFlags, size_t) override;
+
+    rcp<RenderShader> makeLinearGradient(float sx,
+                                         float sy,
+                                         float ex,
+                                         float ey,
+                                         const ColorInt colors[], // [count]
+                                         const float stops[],     // [count]
+                                         size_t count) override;
+
+    rcp<RenderShader> makeRadialGradient(float cx,
+                                         float cy,
+                                         float radius,
+                                         const ColorInt colors[], // [count]
+                                         const float stops[],     // [count]
+                                         size_t count) override;
+
+    rcp<RenderPath> makeRenderPath(RawPath&, FillRule) override;
+
+    rcp<RenderPath> makeEmptyRenderPath() override;
+
+    rcp<RenderPaint> makeRenderPaint() override;
+
+    rcp<RenderImage> decodeImage(Span<const uint8_t>) override;
+
+    rcp<RenderImage> decodeScaledImage(Span<const uint8_t>, uint32_t maxDimension) override;
+    bool canDecodeScaled() const override { return true; }
+
+    /// Wraps already decoded, premultiplied RGBA8 pixels (width * height * 4
+    /// bytes) as an image.
+    rcp<RenderImage> makeImage(uint32_t width, uint32_t height, std::vector<uint8_t> pixels);
+};
+
+/// Headless renderer that rasterizes on the CPU into premultiplied RGBA8
+/// pixels. Draw calls are recorded and rasterized when flush() is called, in
+/// tiles, optionally spread across threads.
+class SoftwareRenderer : public Renderer
+{
+public:
+    /// threadCount of 1 rasterizes on the thread calling flush.
+    SoftwareRenderer(uint32_t width, uint32_t height, uint32_t threadCount = 1);
+    ~SoftwareRenderer() override;
+
+    uint32_t width() const { return m_width; }
+    uint32_t height() const { return m_height; }
+
+    /// Fills every pixel with color, dropping any unflushed draws.
+    void clear(ColorInt color = 0x00000000);
+
+    /// Rasterizes everything drawn since the last flush.
+    void flush();
+
+    /// width * height premultiplied RGBA8 pixels, up to date after flush().
+    const uint8_t* pixels() const { return m_pixels.data(); }
+    ColorInt pixel(uint32_t x, uint32_t y) const;
+
+    void save() override;
+    void restore() override;
+    void transform(const Mat2D& transform) override;
+    void drawPath(RenderPath* path, RenderPaint* paint) override;
+    void clipPath(RenderPath* path) override;
+    void drawImage(const RenderImage*, BlendMode, float opacity) override;
+    void drawImageMesh(const RenderImage*,
+                       rcp<RenderBuffer> vertices_f32,
+                       rcp<RenderBuffer> uvCoords_f32,
+                       rcp<RenderBuffer> indices_u16,
+                       uint32_t vertexCount,
+                       uint32_t indexCount,
+                       BlendMode,
+                       float opacity) override;
+
+private:
+    struct State
+    {
+        Mat2D transform;
+        std::shared_ptr<const software::ClipState> clip;
+    };
+
+    void addCommand(std::unique_ptr<software::DrawCommand> command);
+
+    uint32_t m_width;
+    uint32_t m_height;
+    uint32_t m_threadCount;
+    std::vector<uint8_t> m_pixels;
+    std::vector<State> m_stack;
+    std::vector<std::unique_ptr<software::DrawCommand>> m_commands;
+};
+} // namespace rive
+#endif
@@ -0,0 +1,580 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "software_rasterizer.hpp"
+
+#include "rive/math/math_types.hpp"
+#include "rive/math/raw_path_utils.hpp"
+#include "rive/math/simd.hpp"
+#include "rive/math/wangs_formula.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace rive;
+using namespace rive::software;
+
+// Joins longer than this (relative to the stroke's half width) fall back to a
+// bevel, same as Skia's default.
+static constexpr float kMiterLimit = 4.0f;
+static constexpr int kMaxCurveSegments = 256;
+
+void Polygon::closeContour()
+{
+    uint32_t start = m_contourEnds.empty() ? 0 : m_contourEnds.back();
+    if (m_points.size() - start < 3)
+    {
+        // Not enough points to cover any area.
+        m_points.resize(start);
+        return;
+    }
+    m_contourEnds.push_back((uint32_t)m_points.size());
+}
+
+void Polygon::addContour(const Vec2D* points, size_t count)
+{
+    m_points.insert(m_points.end(), points, points + count);
+    closeContour();
+}
+
+void Polygon::append(const Polygon& other)
+{
+    uint32_t base = (uint32_t)m_points.size();
+    m_points.insert(m_points.end(), other.m_points.begin(), other.m_points.end());
+    for (uint32_t end : other.m_contourEnds)
+    {
+        m_contourEnds.push_back(base + end);
+    }
+}
+
+void Polygon::transform(const Mat2D& matrix)
+{
+    for (Vec2D& point : m_points)
+    {
+        point = matrix * point;
+    }
+}
+
+void Polygon::clear()
+{
+    m_points.clear();
+    m_contourEnds.clear();
+}
+
+IAABB Polygon::pixelBounds() const
+{
+    if (m_contourEnds.empty())
+    {
+        return {0, 0, 0, 0};
+    }
+    AABB bounds(m_points.front().x, m_points.front().y, m_points.front().x, m_points.front().y);
+    for (const Vec2D& point : m_points)
+    {
+        bounds.minX = std::min(bounds.minX, point.x);
+        bounds.minY = std::min(bounds.minY, point.y);
+        bounds.maxX = std::max(bounds.maxX, point.x);
+        bounds.maxY = std::max(bounds.maxY, point.y);
+    }
+    if (!(bounds.minX > -1e7f && bounds.maxX < 1e7f && bounds.minY > -1e7f && bounds.maxY < 1e7f))
+    {
+        // Non-finite or absurdly large, clamp so integer math stays sane.
+        bounds.minX = std::max(bounds.minX, -1e7f);
+        bounds.minY = std::max(bounds.minY, -1e7f);
+        bounds.maxX = std::min(bounds.maxX, 1e7f);
+        bounds.maxY = std::min(bounds.maxY, 1e7f);
+        if (!(bounds.minX <= bounds.maxX && bounds.minY <= bounds.maxY))
+        {
+            return {0, 0, 0, 0};
+        }
+    }
+    return {(int32_t)std::floor(bounds.minX),
+            (int32_t)std::floor(bounds.minY),
+            (int32_t)std::ceil(bounds.maxX) + 1,
+            (int32_t)std::ceil(bounds.maxY) + 1};
+}
+
+void rive::software::flatten(const RawPath& path,
+                             const Mat2D& transform,
+                             float precision,
+                             std::vector<Polyline>* polylines)
+{
+    Polyline* current = nullptr;
+    for (auto iter : path)
+    {
+        PathVerb verb = std::get<0>(iter);
+        const Vec2D* pts = std::get<1>(iter);
+        switch (verb)
+        {
+            case PathVerb::move:
+                polylines->emplace_back();
+                current = &polylines->back();
+                current->points.push_back(transform * pts[0]);
+                break;
+            case PathVerb::line:
+                current->points.push_back(transform * pts[1]);
+                break;
+            case PathVerb::quad:
+            {
+                Vec2D quad[3] = {transform * pts[0], transform * pts[1], transform * pts[2]};
+                int count = (int)std::ceil(wangs_formula::quadratic(quad, precision));
+                count = std::max(1, std::min(count, kMaxCurveSegments));
+                EvalQuad eval(quad);
+                for (int i = 1; i < count; i++)
+                {
+                    current->points.push_back(eval((float)i / count));
+                }
+                current->points.push_back(quad[2]);
+                break;
+            }
+            case PathVerb::cubic:
+            {
+                Vec2D cubic[4] = {transform * pts[0],
+                                  transform * pts[1],
+                                  transform * pts[2],
+                                  transform * pts[3]};
+                int count = (int)std::ceil(wangs_formula::cubic(cubic, precision));
+                count = std::max(1, std::min(count, kMaxCurveSegments));
+                EvalCubic eval(cubic);
+                for (int i = 1; i < count; i++)
+                {
+                    current->points.push_back(eval((float)i / count));
+                }
+                current->points.push_back(cubic[3]);
+                break;
+            }
+            case PathVerb::close:
+                current->isClosed = true;
+                break;
+        }
+    }
+}
+
+void rive::software::fill(const std::vector<Polyline>& polylines, Polygon* polygon)
+{
+    for (const Polyline& polyline : polylines)
+    {
+        polygon->addContour(polyline.points.data(), polyline.points.size());
+    }
+}
+
+// Adds a convex contour wound counter clockwise (in a y-down space) so that
+// overlapping stroke pieces never cancel each other out.
+static void addConvex(Polygon* polygon, Vec2D* points, size_t count)
+{
+    float area = 0.0f;
+    for (size_t i = 0; i < count; i++)
+    {
+        area += Vec2D::cross(points[i], points[(i + 1) % count]);
+    }
+    if (area == 0.0f)
+    {
+        return;
+    }
+    if (area < 0.0f)
+    {
+        std::reverse(points, points + count);
+    }
+    polygon->addContour(points, count);
+}
+
+static void addCircle(Polygon* polygon, Vec2D center, float radius, float precision)
+{
+    float tolerance = 1.0f / precision;
+    int count = 4;
+    if (radius > tolerance)
+    {
+        float step = 2.0f * std::acos(1.0f - tolerance / radius);
+        count = std::max(4, std::min((int)std::ceil(math::PI * 2.0f / step), kMaxCurveSegments));
+    }
+    std::vector<Vec2D> points(count);
+    for (int i = 0; i < count; i++)
+    {
+        float angle = math::PI * 2.0f * i / count;
+        points[i] = center + Vec2D(std::cos(angle), std::sin(angle)) * radius;
+    }
+    addConvex(polygon, points.data(), points.size());
+}
+
+static Vec2D perpendicular(Vec2D v) { return {-v.y, v.x}; }
+
+static void addJoin(Polygon* polygon,
+                    Vec2D point,
+                    Vec2D inDirection,
+                    Vec2D outDirection,
+                    float halfWidth,
+                    StrokeJoin join,
+                    float precision)
+{
+    float turn = Vec2D::cross(inDirection, outDirection);
+    float dot = Vec2D::dot(inDirection, outDirection);
+    if (std::abs(turn) < 1e-6f && dot > 0.0f)
+    {
+        // Straight through, the segment quads already meet.
+        return;
+    }
+    if (join == StrokeJoin::round)
+    {
+        addCircle(polygon, point, halfWidth, precision);
+        return;
+    }
+
+    // Only the outside of the turn needs filling in.
+    float side = turn > 0.0f ? -1.0f : 1.0f;
+    Vec2D n0 = perpendicular(inDirection) * side;
+    Vec2D n1 = perpendicular(outDirection) * side;
+    if (join == StrokeJoin::miter)
+    {
+        Vec2D bisector = n0 + n1;
+        float bisectorLength = bisector.length();
+        if (bisectorLength > 1e-6f)
+        {
+            bisector = bisector / bisectorLength;
+            float cosHalfAngle = Vec2D::dot(bisector, n0);
+            if (cosHalfAngle > 1.0f / kMiterLimit)
+            {
+                Vec2D miter[4] = {point,
+                                  point + n0 * halfWidth,
+                                  point + bisector * (halfWidth / cosHalfAngle),
+                                  point + n1 * halfWidth};
+                addConvex(polygon, miter, 4);
+                return;
+            }
+        }
+    }
+    Vec2D bevel[3] = {point, point + n0 * halfWidth, point + n1 * halfWidth};
+    addConvex(polygon, bevel, 3);
+}
+
+static void addCap(Polygon* polygon,
+                   Vec2D point,
+                   Vec2D outwardDirection,
+                   float halfWidth,
+                   StrokeCap cap,
+                   float precision)
+{
+    switch (cap)
+    {
+        case StrokeCap::butt:
+            break;
+        case StrokeCap::round:
+            addCircle(polygon, point, halfWidth, precision);
+            break;
+        case StrokeCap::square:
+        {
+            Vec2D normal = perpendicular(outwardDirection) * halfWidth;
+            Vec2D extension = outwardDirection * halfWidth;
+            Vec2D square[4] = {point + normal,
+                               point + normal + extension,
+                               point - normal + extension,
+                               point - normal};
+            addConvex(polygon, square, 4);
+            break;
+        }
+    }
+}
+
+void rive::software::stroke(const std::vector<Polyline>& polylines,
+                            float thickness,
+                            StrokeJoin join,
+                            StrokeCap cap,
+                            float precision,
+                            const Mat2D& transform,
+                            Polygon* polygon)
+{
+    float halfWidth = thickness * 0.5f;
+    if (!(halfWidth > 0.0f))
+    {
+        return;
+    }
+    // Build the stroke in local space and move it to the destination at the
+    // end.
+    Polygon local;
+    std::vector<Vec2D> points;
+    for (const Polyline& polyline : polylines)
+    {
+        points.clear();
+        for (const Vec2D& point : polyline.points)
+        {
+            if (points.empty() || point != points.back())
+            {
+                points.push_back(point);
+            }
+        }
+        bool isClosed = polyline.isClosed;
+        if (isClosed && points.size() > 1 && points.front() == points.back())
+        {
+            points.pop_back();
+        }
+        if (points.empty())
+        {
+            continue;
+        }
+        if (points.size() == 1)
+        {
+            // Zero length contours only show their caps.
+            if (!isClosed)
+            {
+                addCap(&local, points[0], Vec2D(-1.0f, 0.0f), halfWidth, cap, precision);
+                addCap(&local, points[0], Vec2D(1.0f, 0.0f), halfWidth, cap, precision);
+            }
+            continue;
+        }
+
+        size_t count = points.size();
+        size_t segmentCount = isClosed ? count : count - 1;
+        Vec2D firstDirection, previousDirection;
+        for (size_t i = 0; i < segmentCount; i++)
+        {
+            Vec2D from = points[i];
+            Vec2D to = points[(i + 1) % count];
+            Vec2D direction = (to - from).normalized();
+            Vec2D normal = perpendicular(direction) * halfWidth;
+            Vec2D quad[4] = {from + normal, to + normal, to - normal, from - normal};
+            addConvex(&local, quad, 4);
+            if (i == 0)
+            {
+                firstDirection = direction;
+            }
+            else
+            {
+                addJoin(&local, from, previousDirection, direction, halfWidth, join, precision);
+            }
+            previousDirection = direction;
+        }
+        if (isClosed)
+        {
+            addJoin(&local,
+                    points[0],
+                    previousDirection,
+                    firstDirection,
+                    halfWidth,
+                    join,
+                    precision);
+        }
+        else
+        {
+            addCap(&local, points[0], -firstDirection, halfWidth, cap, precision);
+            addCap(&local, points[count - 1], previousDirection, halfWidth, cap, precision);
+        }
+    }
+
+    local.transform(transform);
+    polygon->append(local);
+}
+
+IAABB CoverageRasterizer::rasterize(const Polygon& polygon,
+                                    FillRule fillRule,
+                                    const IAABB& tile,
+                                    float* coverage)
+{
+    m_width = tile.width();
+    m_height = tile.height();
+    m_stride = m_width + 2;
+    size_t size = (size_t)m_stride * m_height;
+    if (m_accumulation.size() < size)
+    {
+        m_accumulation.resize(size, 0.0f);
+    }
+    m_minX = (float)m_width;
+    m_minY = m_height;
+    m_maxY = 0;
+
+    Vec2D offset((float)tile.left, (float)tile.top);
+    const std::vector<Vec2D>& points = polygon.points();
+    uint32_t start = 0;
+    for (uint32_t end : polygon.contourEnds())
+    {
+        Vec2D previous = points[end - 1] - offset;
+        for (uint32_t i = start; i < end; i++)
+        {
+            Vec2D point = points[i] - offset;
+            clippedLine(previous, point);
+            previous = point;
+        }
+        start = end;
+    }
+
+    if (m_minY >= m_maxY)
+    {
+        return {0, 0, 0, 0};
+    }
+
+    int minX = std::max(0, std::min(m_width, (int)m_minX));
+    for (int y = m_minY; y < m_maxY; y++)
+    {
+        float* row = &m_accumulation[(size_t)y * m_stride];
+        float* out = coverage + (size_t)y * m_width;
+        int x = minX;
+        float4 carry = 0.0f;
+        for (; x + 4 <= m_width; x += 4)
+        {
+            // Prefix sum of 4 lanes.
+            float4 sum = simd::load4f(row + x);
+            sum += float4{0.0f, sum.x, sum.y, sum.z};
+            sum += float4{0.0f, 0.0f, sum.x, sum.y};
+            sum += carry;
+            carry = sum.w;
+
+            float4 winding = simd::abs(sum);
+            if (fillRule == FillRule::evenOdd)
+            {
+                winding -= 2.0f * simd::floor(winding * 0.5f);
+                winding = simd::min(winding, 2.0f - winding);
+            }
+            simd::store(out + x, simd::min(winding, float4(1.0f)));
+        }
+        float accumulated = carry.x;
+        for (; x < m_width; x++)
+        {
+            accumulated += row[x];
+            float winding = std::abs(accumulated);
+            if (fillRule == FillRule::evenOdd)
+            {
+                winding -= 2.0f * std::floor(winding * 0.5f);
+                winding = std::min(winding, 2.0f - winding);
+            }
+            out[x] = std::min(winding, 1.0f);
+        }
+        // Leave the accumulation buffer clean for the next polygon.
+        std::fill(row, row + m_stride, 0.0f);
+    }
+    return {minX, m_minY, m_width, m_maxY};
+}
+
+void CoverageRasterizer::clippedLine(Vec2D p0, Vec2D p1)
+{
+    float width = (float)m_width;
+    if ((p0.x <= 0.0f && p1.x <= 0.0f) || (p0.x >= width && p1.x >= width) ||
+        p0.x == p1.x)
+    {
+        // Entirely left of the tile acts like a vertical edge on its left
+        // side, entirely right of it doesn't affect it at all.
+        if (p0.x < width || p1.x < width)
+        {
+            line(Vec2D(std::max(0.0f, std::min(p0.x, width)), p0.y),
+                 Vec2D(std::max(0.0f, std::min(p1.x, width)), p1.y));
+        }
+        return;
+    }
+
+    // Split where the segment crosses the tile's left and right sides.
+    float splits[4];
+    int splitCount = 0;
+    splits[splitCount++] = 0.0f;
+    float dx = p1.x - p0.x;
+    float tLeft = (0.0f - p0.x) / dx;
+    float tRight = (width - p0.x) / dx;
+    if (tLeft > tRight)
+    {
+        std::swap(tLeft, tRight);
+    }
+    if (tLeft > 0.0f && tLeft < 1.0f)
+    {
+        splits[splitCount++] = tLeft;
+    }
+    if (tRight > 0.0f && tRight < 1.0f)
+    {
+        splits[splitCount++] = tRight;
+    }
+    splits[splitCount++] = 1.0f;
+
+    Vec2D from = p0;
+    for (int i = 1; i < splitCount; i++)
+    {
+        Vec2D to = i == splitCount - 1 ? p1 : Vec2D::lerp(p0, p1, splits[i]);
+        float midX = (from.x + to.x) * 0.5f;
+        if (midX < width)
+        {
+            if (midX <= 0.0f)
+            {
+                line(Vec2D(0.0f, from.y), Vec2D(0.0f, to.y));
+            }
+            else
+            {
+                line(Vec2D(std::max(0.0f, std::min(from.x, width)), from.y),
+                     Vec2D(std::max(0.0f, std::min(to.x, width)), to.y));
+            }
+        }
+        from = to;
+    }
+}
+
+// Accumulates the signed area of a line segment, adapted from font-rs
+// (https://github.com/raphlinus/font-rs). x is already within [0, width].
+void CoverageRasterizer::line(Vec2D p0, Vec2D p1)
+{
+    if (p0.y == p1.y)
+    {
+        return;
+    }
+    float direction = 1.0f;
+    if (p0.y > p1.y)
+    {
+        std::swap(p0, p1);
+        direction = -1.0f;
+    }
+    if (p1.y <= 0.0f || p0.y >= (float)m_height)
+    {
+        return;
+    }
+    float dxdy = (p1.x - p0.x) / (p1.y - p0.y);
+    float x = p0.x;
+    float top = p0.y;
+    if (top < 0.0f)
+    {
+        x -= top * dxdy;
+        top = 0.0f;
+    }
+    int y0 = (int)top;
+    int y1 = std::min(m_height, (int)std::ceil(p1.y));
+    float maxX = (float)m_width;
+    m_minY = std::min(m_minY, y0);
+    m_maxY = std::max(m_maxY, y1);
+    for (int y = y0; y < y1; y++)
+    {
+        float* row = &m_accumulation[(size_t)y * m_stride];
+        float dy = std::min((float)(y + 1), p1.y) - std::max((float)y, top);
+        float xNext = x + dxdy * dy;
+        float d = dy * direction;
+        float x0 = std::max(0.0f, std::min(std::min(x, xNext), maxX));
+        float x1 = std::max(0.0f, std::min(std::max(x, xNext), maxX));
+        m_minX = std::min(m_minX, x0);
+        float x0Floor = std::floor(x0);
+        int x0i = (int)x0Floor;
+        float x1Ceil = std::ceil(x1);
+        int x1i = (int)x1Ceil;
+        if (x1i <= x0i + 1)
+        {
+            float xmf = 0.5f * (x0 + x1) - x0Floor;
+            row[x0i] += d - d * xmf;
+            row[x0i + 1] += d * xmf;
+        }
+        else
+        {
+            float s = 1.0f / (x1 - x0);
+            float x0f = x0 - x0Floor;
+            float a0 = 0.5f * s * (1.0f - x0f) * (1.0f - x0f);
+            float x1f = x1 - x1Ceil + 1.0f;
+            float am = 0.5f * s * x1f * x1f;
+            row[x0i] += d * a0;
+            if (x1i == x0i + 2)
+            {
+                row[x0i + 1] += d * (1.0f - a0 - am);
+            }
+            else
+            {
+                float a1 = s * (1.5f - x0f);
+                row[x0i + 1] += d * (a1 - a0);
+                for (int xi = x0i + 2; xi < x1i - 1; xi++)
+                {
+                    row[xi] += d * s;
+                }
+                float a2 = a1 + (float)(x1i - x0i - 3) * s;
+                row[x1i - 1] += d * (1.0f - a2 - am);
+            }
+            row[x1i] += d * am;
+        }
+        x = xNext;
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#ifndef _RIVE_SOFTWARE_RASTERIZER_HPP_
+#define _RIVE_SOFTWARE_RASTERIZER_HPP_
+
+#include "rive/math/aabb.hpp"
+#include "rive/math/mat2d.hpp"
+#include "rive/math/path_types.hpp"
+#include "rive/math/raw_path.hpp"
+#include "rive/shapes/paint/stroke_cap.hpp"
+#include "rive/shapes/paint/stroke_join.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// Geometry and coverage helpers for the software renderer. Everything in here
+// works on plain arrays so a command can be rasterized into any tile from any
+// thread.
+namespace rive
+{
+namespace software
+{
+// A flattened contour.
+struct Polyline
+{
+    std::vector<Vec2D> points;
+    bool isClosed = false;
+};
+
+// Closed contours ready to be rasterized, usually in device space.
+class Polygon
+{
+public:
+    void addPoint(Vec2D point) { m_points.push_back(point); }
+    // Ends the current contour, it's implicitly closed when rasterized.
+    void closeContour();
+    void addContour(const Vec2D* points, size_t count);
+    void append(const Polygon& other);
+    void transform(const Mat2D& matrix);
+    void clear();
+
+    const std::vector<Vec2D>& points() const { return m_points; }
+    const std::vector<uint32_t>& contourEnds() const { return m_contourEnds; }
+    bool empty() const { return m_contourEnds.empty(); }
+
+    // Integer bounds that contain every pixel the polygon can touch.
+    IAABB pixelBounds() const;
+
+private:
+    std::vector<Vec2D> m_points;
+    std::vector<uint32_t> m_contourEnds;
+};
+
+// Flattens every contour of path (after mapping it by transform) into line
+// segments within 1/precision units of the curves.
+void flatten(const RawPath& path,
+             const Mat2D& transform,
+             float precision,
+             std::vector<Polyline>* polylines);
+
+// Appends polylines to polygon as closed contours.
+void fill(const std::vector<Polyline>& polylines, Polygon* polygon);
+
+// Expands polylines (in local space) into a polygon covering the stroke and
+// maps it by transform. All contours are wound the same way, so the result
+// must be rasterized with the nonZero fill rule.
+void stroke(const std::vector<Polyline>& polylines,
+            float thickness,
+            StrokeJoin join,
+            StrokeCap cap,
+            float precision,
+            const Mat2D& transform,
+            Polygon* polygon);
+
+// Sparse scanline coverage rasterizer. Edges accumulate signed area into a
+// per row buffer, a prefix sum across each row then yields the exact analytic
+// coverage (the winding number, averaged over the pixel).
+class CoverageRasterizer
+{
+public:
+    // Rasterizes polygon into the tile, writing width * height coverage
+    // values into coverage. Only rows and columns inside the returned bounds
+    // (relative to the tile) are written, everything else is zero coverage.
+    IAABB rasterize(const Polygon& polygon, FillRule, const IAABB& tile, float* coverage);
+
+private:
+    void clippedLine(Vec2D p0, Vec2D p1);
+    void line(Vec2D p0, Vec2D p1);
+
+    std::vector<float> m_accumulation;
+    int m_width = 0;
+    int m_height = 0;
+    int m_stride = 0;
+    float m_minX = 0.0f;
+    int m_minY = 0;
+    int m_maxY = 0;
+};
+} // namespace software
+} // namespace rive
+#endif
@@ -0,0 +1,945 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "software_renderer.hpp"
+
+#include "software_rasterizer.hpp"
+#include "rive/decoders/bitmap_decoder.hpp"
+#include "rive/math/simd.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+using namespace rive;
+using namespace rive::software;
+
+// Curves are flattened to within a quarter pixel.
+static constexpr float kPrecision = 4.0f;
+static constexpr int kTileSize = 64;
+static constexpr int kGradientLutSize = 256;
+
+static float4 premultipliedColor(ColorInt color)
+{
+    float4 rgba = simd::cast<float>(color << uint4{8, 16, 24, 0} >> 24u) * (1.0f / 255.0f);
+    return rgba * float4{rgba.w, rgba.w, rgba.w, 1.0f};
+}
+
+static IAABB intersect(const IAABB& a, const IAABB& b)
+{
+    return {std::max(a.left, b.left),
+            std::max(a.top, b.top),
+            std::min(a.right, b.right),
+            std::min(a.bottom, b.bottom)};
+}
+
+namespace
+{
+class SoftwareRenderBuffer : public lite_rtti_override<RenderBuffer, SoftwareRenderBuffer>
+{
+public:
+    SoftwareRenderBuffer(RenderBufferType type, RenderBufferFlags flags, size_t sizeInBytes) :
+        lite_rtti_override(type, flags, sizeInBytes), m_bytes(sizeInBytes)
+    {}
+
+    const uint8_t* bytes() const { return m_bytes.data(); }
+
+protected:
+    void* onMap() override { return m_bytes.data(); }
+    void onUnmap() override {}
+
+private:
+    std::vector<uint8_t> m_bytes;
+};
+
+class SoftwareShader : public lite_rtti_override<RenderShader, SoftwareShader>
+{
+public:
+    SoftwareShader(bool isRadial,
+                   Vec2D start,
+                   Vec2D end,
+                   float radius,
+                   const ColorInt colors[],
+                   const float stops[],
+                   size_t count) :
+        m_isRadial(isRadial), m_start(start), m_end(end), m_radius(radius)
+    {
+        Vec2D axis = end - start;
+        float lengthSquared = Vec2D::dot(axis, axis);
+        m_inverseLengthSquared = lengthSquared > 0.0f ? 1.0f / lengthSquared : 0.0f;
+
+        // Interpolate the stops (unpremultiplied) into a lookup table.
+        size_t stop = 0;
+        for (int i = 0; i < kGradientLutSize; i++)
+        {
+            float t = (float)i / (kGradientLutSize - 1);
+            while (stop + 1 < count && stops[stop + 1] < t)
+            {
+                stop++;
+            }
+            float4 color;
+            if (count == 0)
+            {
+                color = 0.0f;
+            }
+            else if (t <= stops[0] || count == 1)
+            {
+                color = unpremultiplied(colors[0]);
+            }
+            else if (stop + 1 >= count)
+            {
+                color = unpremultiplied(colors[count - 1]);
+            }
+            else
+            {
+                float range = stops[stop + 1] - stops[stop];
+                float f = range > 0.0f ? (t - stops[stop]) / range : 1.0f;
+                color = simd::precise_mix(unpremultiplied(colors[stop]),
+                                  unpremultiplied(colors[stop + 1]),
+                                  float4(std::max(0.0f, std::min(1.0f, f))));
+            }
+            m_lut[i] = color * float4{color.w, color.w, color.w, 1.0f};
+        }
+    }
+
+    float4 sample(Vec2D local) const
+    {
+        float t;
+        if (m_isRadial)
+        {
+            t = m_radius > 0.0f ? Vec2D::distance(local, m_start) / m_radius : 1.0f;
+        }
+        else
+        {
+            t = Vec2D::dot(local - m_start, m_end - m_start) * m_inverseLengthSquared;
+        }
+        t = std::max(0.0f, std::min(1.0f, t));
+        return m_lut[(int)(t * (kGradientLutSize - 1) + 0.5f)];
+    }
+
+private:
+    static float4 unpremultiplied(ColorInt color)
+    {
+        return simd::cast<float>(color << uint4{8, 16, 24, 0} >> 24u) * (1.0f / 255.0f);
+    }
+
+    bool m_isRadial;
+    Vec2D m_start;
+    Vec2D m_end;
+    float m_radius;
+    float m_inverseLengthSquared;
+    float4 m_lut[kGradientLutSize];
+};
+
+class SoftwareRenderPaint : public lite_rtti_override<RenderPaint, SoftwareRenderPaint>
+{
+public:
+    void style(RenderPaintStyle value) override { m_style = value; }
+    void color(ColorInt value) override { m_color = value; }
+    void thickness(float value) override { m_thickness = value; }
+    void join(StrokeJoin value) override { m_join = value; }
+    void cap(StrokeCap value) override { m_cap = value; }
+    void blendMode(BlendMode value) override { m_blendMode = value; }
+    void shader(rcp<RenderShader> value) override
+    {
+        m_shader = ref_rcp(lite_rtti_cast<SoftwareShader*>(value.get()));
+    }
+    void invalidateStroke() override {}
+
+    RenderPaintStyle style() const { return m_style; }
+    ColorInt color() const { return m_color; }
+    float thickness() const { return m_thickness; }
+    StrokeJoin join() const { return m_join; }
+    StrokeCap cap() const { return m_cap; }
+    BlendMode blendMode() const { return m_blendMode; }
+    const rcp<SoftwareShader>& shader() const { return m_shader; }
+
+private:
+    RenderPaintStyle m_style = RenderPaintStyle::fill;
+    ColorInt m_color = 0xff000000;
+    float m_thickness = 1.0f;
+    StrokeJoin m_join = StrokeJoin::miter;
+    StrokeCap m_cap = StrokeCap::butt;
+    BlendMode m_blendMode = BlendMode::srcOver;
+    rcp<SoftwareShader> m_shader;
+};
+
+class SoftwareRenderPath : public lite_rtti_override<RenderPath, SoftwareRenderPath>
+{
+public:
+    SoftwareRenderPath() = default;
+    SoftwareRenderPath(RawPath& rawPath, FillRule fillRule) : m_fillRule(fillRule)
+    {
+        m_rawPath.swap(rawPath);
+    }
+
+    void rewind() override { m_rawPath.rewind(); }
+    void fillRule(FillRule value) override { m_fillRule = value; }
+    void addRenderPath(RenderPath* path, const Mat2D& transform) override
+    {
+        auto softwarePath = lite_rtti_cast<SoftwareRenderPath*>(path);
+        if (softwarePath != nullptr)
+        {
+            m_rawPath.addPath(softwarePath->m_rawPath, &transform);
+        }
+    }
+
+    void moveTo(float x, float y) override { m_rawPath.moveTo(x, y); }
+    void lineTo(float x, float y) override { m_rawPath.lineTo(x, y); }
+    void cubicTo(float ox, float oy, float ix, float iy, float x, float y) override
+    {
+        m_rawPath.cubicTo(ox, oy, ix, iy, x, y);
+    }
+    void close() override { m_rawPath.close(); }
+
+    const RawPath& rawPath() const { return m_rawPath; }
+    FillRule fillRule() const { return m_fillRule; }
+    size_t byteSize() const override { return m_rawPath.byteSize(); }
+
+private:
+    RawPath m_rawPath;
+    FillRule m_fillRule = FillRule::nonZero;
+};
+
+class SoftwareRenderImage : public lite_rtti_override<RenderImage, SoftwareRenderImage>
+{
+public:
+    SoftwareRenderImage(uint32_t width, uint32_t height, std::vector<uint8_t> pixels) :
+        m_pixels(std::move(pixels))
+    {
+        m_Width = (int)width;
+        m_Height = (int)height;
+    }
+
+    // Bilinear sample at a position in pixels, clamped to the edges.
+    float4 sample(Vec2D position) const
+    {
+        float x = std::max(0.0f, std::min(position.x - 0.5f, (float)(m_Width - 1)));
+        float y = std::max(0.0f, std::min(position.y - 0.5f, (float)(m_Height - 1)));
+        int x0 = (int)x;
+        int y0 = (int)y;
+        int x1 = std::min(x0 + 1, m_Width - 1);
+        int y1 = std::min(y0 + 1, m_Height - 1);
+        float fx = x - (float)x0;
+        float fy = y - (float)y0;
+        float4 top = simd::precise_mix(texel(x0, y0), texel(x1, y0), float4(fx));
+        float4 bottom = simd::precise_mix(texel(x0, y1), texel(x1, y1), float4(fx));
+        return simd::precise_mix(top, bottom, float4(fy));
+    }
+
+private:
+    float4 texel(int x, int y) const
+    {
+        const uint8_t* pixel = &m_pixels[((size_t)y * m_Width + x) * 4];
+        return simd::cast<float>(simd::load<uint8_t, 4>(pixel)) * (1.0f / 255.0f);
+    }
+
+    std::vector<uint8_t> m_pixels;
+};
+} // namespace
+
+namespace rive
+{
+namespace software
+{
+struct ClipState
+{
+    std::shared_ptr<const ClipState> parent;
+    Polygon polygon;
+    FillRule fillRule;
+    // Pixels outside of these bounds are clipped out, includes the parents.
+    IAABB bounds;
+};
+
+struct DrawCommand
+{
+    enum class Type
+    {
+        path,
+        image,
+        mesh,
+    };
+    Type type = Type::path;
+    Polygon polygon;
+    FillRule fillRule = FillRule::nonZero;
+    IAABB bounds;
+    std::shared_ptr<const ClipState> clip;
+    BlendMode blendMode = BlendMode::srcOver;
+    float4 color = 0.0f;
+    rcp<SoftwareShader> shader;
+    rcp<SoftwareRenderImage> image;
+    float opacity = 1.0f;
+    // Maps device space back to the draw's local space for shaders and images.
+    Mat2D inverseTransform;
+    // Meshes keep device space vertices and normalized uvs.
+    std::vector<Vec2D> vertices;
+    std::vector<Vec2D> uvs;
+    std::vector<uint16_t> indices;
+};
+} // namespace software
+} // namespace rive
+
+// Factory
+
+rcp<RenderBuffer> SoftwareFactory::makeRenderBuffer(RenderBufferType type,
+                                                    RenderBufferFlags flags,
+                                                    size_t sizeInBytes)
+{
+    return make_rcp<SoftwareRenderBuffer>(type, flags, sizeInBytes);
+}
+
+rcp<RenderShader> SoftwareFactory::makeLinearGradient(float sx,
+                                                      float sy,
+                                                      float ex,
+                                                      float ey,
+                                                      const ColorInt colors[], // [count]
+                                                      const float stops[],     // [count]
+                                                      size_t count)
+{
+    return make_rcp<SoftwareShader>(false,
+                                    Vec2D(sx, sy),
+                                    Vec2D(ex, ey),
+                                    0.0f,
+                                    colors,
+                                    stops,
+                                    count);
+}
+
+rcp<RenderShader> SoftwareFactory::makeRadialGradient(float cx,
+                                                      float cy,
+                                                      float radius,
+                                                      const ColorInt colors[], // [count]
+                                                      const float stops[],     // [count]
+                                                      size_t count)
+{
+    return make_rcp<SoftwareShader>(true,
+                                    Vec2D(cx, cy),
+                                    Vec2D(cx, cy),
+                                    radius,
+                                    colors,
+                                    stops,
+                                    count);
+}
+
+rcp<RenderPath> SoftwareFactory::makeRenderPath(RawPath& rawPath, FillRule fillRule)
+{
+    return make_rcp<SoftwareRenderPath>(rawPath, fillRule);
+}
+
+rcp<RenderPath> SoftwareFactory::makeEmptyRenderPath() { return make_rcp<SoftwareRenderPath>(); }
+
+rcp<RenderPaint> SoftwareFactory::makeRenderPaint() { return make_rcp<SoftwareRenderPaint>(); }
+
+rcp<RenderImage> SoftwareFactory::decodeImage(Span<const uint8_t> bytes)
+{
+    return decodeScaledImage(bytes, 0);
+}
+
+rcp<RenderImage> SoftwareFactory::decodeScaledImage(Span<const uint8_t> bytes,
+                                                    uint32_t maxDimension)
+{
+    // Decode straight into the premultiplied pixels the image keeps.
+    Bitmap::DecodeOptions options;
+    options.maxDimension = maxDimension;
+    options.hasPixelFormat = true;
+    options.pixelFormat = Bitmap::PixelFormat::RGBAPremul;
+    std::vector<uint8_t> pixels;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    auto allocate = [&](uint32_t w, uint32_t h, Bitmap::PixelFormat) {
+        width = w;
+        height = h;
+        pixels.resize((size_t)w * h * 4);
+        return pixels.data();
+    };
+    if (!Bitmap::decode(bytes.data(), bytes.size(), options, allocate))
+    {
+        return nullptr;
+    }
+    return makeImage(width, height, std::move(pixels));
+}
+
+rcp<RenderImage> SoftwareFactory::makeImage(uint32_t width,
+                                            uint32_t height,
+                                            std::vector<uint8_t> pixels)
+{
+    if (width == 0 || height == 0 || pixels.size() < (size_t)width * height * 4)
+    {
+        return nullptr;
+    }
+    return make_rcp<SoftwareRenderImage>(width, height, std::move(pixels));
+}
+
+// Blending, see https://www.w3.org/TR/compositing-1/
+
+static float luminosity(float4 c) { return 0.3f * c.x + 0.59f * c.y + 0.11f * c.z; }
+
+static float saturation(float4 c)
+{
+    return std::max(c.x, std::max(c.y, c.z)) - std::min(c.x, std::min(c.y, c.z));
+}
+
+static float4 clipColor(float4 c)
+{
+    float l = luminosity(c);
+    float n = std::min(c.x, std::min(c.y, c.z));
+    float x = std::max(c.x, std::max(c.y, c.z));
+    if (n < 0.0f)
+    {
+        c = l + (c - l) * l / (l - n);
+    }
+    if (x > 1.0f)
+    {
+        c = l + (c - l) * (1.0f - l) / (x - l);
+    }
+    return c;
+}
+
+static float4 setLuminosity(float4 c, float l) { return clipColor(c + (l - luminosity(c))); }
+
+static float4 setSaturation(float4 c, float s)
+{
+    float n = std::min(c.x, std::min(c.y, c.z));
+    float x = std::max(c.x, std::max(c.y, c.z));
+    return x > n ? (c - n) * s / (x - n) : float4(0.0f);
+}
+
+static float blendChannel(BlendMode mode, float cb, float cs)
+{
+    switch (mode)
+    {
+        case BlendMode::overlay:
+            return blendChannel(BlendMode::hardLight, cs, cb);
+        case BlendMode::colorDodge:
+            if (cb == 0.0f)
+            {
+                return 0.0f;
+            }
+            return cs >= 1.0f ? 1.0f : std::min(1.0f, cb / (1.0f - cs));
+        case BlendMode::colorBurn:
+            if (cb >= 1.0f)
+            {
+                return 1.0f;
+            }
+            return cs <= 0.0f ? 0.0f : 1.0f - std::min(1.0f, (1.0f - cb) / cs);
+        case BlendMode::hardLight:
+            return cs <= 0.5f ? cb * 2.0f * cs : cb + (2.0f * cs - 1.0f) - cb * (2.0f * cs - 1.0f);
+        case BlendMode::softLight:
+        {
+            if (cs <= 0.5f)
+            {
+                return cb - (1.0f - 2.0f * cs) * cb * (1.0f - cb);
+            }
+            float d = cb <= 0.25f ? ((16.0f * cb - 12.0f) * cb + 4.0f) * cb : std::sqrt(cb);
+            return cb + (2.0f * cs - 1.0f) * (d - cb);
+        }
+        default:
+            return cs;
+    }
+}
+
+// Blends premultiplied src over dst.
+static float4 blend(BlendMode mode, float4 src, float4 dst)
+{
+    float sa = src.w;
+    float da = dst.w;
+    if (mode == BlendMode::srcOver)
+    {
+        return src + dst * (1.0f - sa);
+    }
+    float4 cs = sa > 0.0f ? src / sa : float4(0.0f);
+    float4 cb = da > 0.0f ? dst / da : float4(0.0f);
+    float4 mixed;
+    switch (mode)
+    {
+        case BlendMode::screen:
+            mixed = cb + cs - cb * cs;
+            break;
+        case BlendMode::darken:
+            mixed = simd::min(cb, cs);
+            break;
+        case BlendMode::lighten:
+            mixed = simd::max(cb, cs);
+            break;
+        case BlendMode::difference:
+            mixed = simd::abs(cb - cs);
+            break;
+        case BlendMode::exclusion:
+            mixed = cb + cs - 2.0f * cb * cs;
+            break;
+        case BlendMode::multiply:
+            mixed = cb * cs;
+            break;
+        case BlendMode::hue:
+            mixed = setLuminosity(setSaturation(cs, saturation(cb)), luminosity(cb));
+            break;
+        case BlendMode::saturation:
+            mixed = setLuminosity(setSaturation(cb, saturation(cs)), luminosity(cb));
+            break;
+        case BlendMode::color:
+            mixed = setLuminosity(cs, luminosity(cb));
+            break;
+        case BlendMode::luminosity:
+            mixed = setLuminosity(cb, luminosity(cs));
+            break;
+        default:
+            for (int i = 0; i < 3; i++)
+            {
+                mixed[i] = blendChannel(mode, cb[i], cs[i]);
+            }
+            break;
+    }
+    float4 result = src * (1.0f - da) + dst * (1.0f - sa) + sa * da * mixed;
+    result.w = sa + da - sa * da;
+    return result;
+}
+
+static void blendPixel(uint8_t* pixel, BlendMode mode, float4 src, float coverage)
+{
+    float4 dst = simd::cast<float>(simd::load<uint8_t, 4>(pixel)) * (1.0f / 255.0f);
+    float4 result = blend(mode, src, dst);
+    if (coverage < 1.0f)
+    {
+        result = simd::precise_mix(dst, result, float4(coverage));
+    }
+    result = simd::clamp(result, float4(0.0f), float4(1.0f));
+    simd::store(pixel, simd::cast<uint8_t>(result * 255.0f + 0.5f));
+}
+
+static float4 shade(const DrawCommand& command, int x, int y)
+{
+    if (command.type == DrawCommand::Type::image)
+    {
+        Vec2D local = command.inverseTransform * Vec2D(x + 0.5f, y + 0.5f);
+        return command.image->sample(local) * command.opacity;
+    }
+    if (command.shader != nullptr)
+    {
+        Vec2D local = command.inverseTransform * Vec2D(x + 0.5f, y + 0.5f);
+        return command.shader->sample(local);
+    }
+    return command.color;
+}
+
+namespace
+{
+// Per thread buffers reused across tiles.
+struct TileScratch
+{
+    CoverageRasterizer rasterizer;
+    std::vector<float> coverage = std::vector<float>(kTileSize * kTileSize);
+    std::vector<float> clipCoverage = std::vector<float>(kTileSize * kTileSize);
+    std::vector<float> clipMask = std::vector<float>(kTileSize * kTileSize);
+    const ClipState* clipState = nullptr;
+};
+} // namespace
+
+// Builds the coverage of the whole clip chain over the tile.
+static void buildClipMask(const ClipState* clip, const IAABB& tile, TileScratch& scratch)
+{
+    int width = tile.width();
+    int height = tile.height();
+    std::fill(scratch.clipMask.begin(), scratch.clipMask.begin() + width * height, 1.0f);
+    for (const ClipState* state = clip; state != nullptr; state = state->parent.get())
+    {
+        IAABB touched = scratch.rasterizer.rasterize(state->polygon,
+                                                     state->fillRule,
+                                                     tile,
+                                                     scratch.clipCoverage.data());
+        for (int y = 0; y < height; y++)
+        {
+            float* mask = &scratch.clipMask[y * width];
+            const float* coverage = &scratch.clipCoverage[y * width];
+            bool rowTouched = y >= touched.top && y < touched.bottom;
+            for (int x = 0; x < width; x++)
+            {
+                mask[x] *= rowTouched && x >= touched.left ? coverage[x] : 0.0f;
+            }
+        }
+    }
+}
+
+static void drawMesh(const DrawCommand& command,
+                     uint8_t* pixels,
+                     uint32_t stride,
+                     const IAABB& tile,
+                     const float* clipMask)
+{
+    const SoftwareRenderImage* image = command.image.get();
+    Vec2D imageSize((float)image->width(), (float)image->height());
+    for (size_t i = 0; i + 2 < command.indices.size(); i += 3)
+    {
+        uint16_t ia = command.indices[i];
+        uint16_t ib = command.indices[i + 1];
+        uint16_t ic = command.indices[i + 2];
+        if (ia >= command.vertices.size() || ib >= command.vertices.size() ||
+            ic >= command.vertices.size())
+        {
+            continue;
+        }
+        Vec2D a = command.vertices[ia];
+        Vec2D b = command.vertices[ib];
+        Vec2D c = command.vertices[ic];
+        float area = Vec2D::cross(b - a, c - a);
+        if (area == 0.0f)
+        {
+            continue;
+        }
+        float inverseArea = 1.0f / area;
+        IAABB bounds = {(int)std::floor(std::min(a.x, std::min(b.x, c.x))),
+                        (int)std::floor(std::min(a.y, std::min(b.y, c.y))),
+                        (int)std::ceil(std::max(a.x, std::max(b.x, c.x))),
+                        (int)std::ceil(std::max(a.y, std::max(b.y, c.y)))};
+        bounds = intersect(bounds, tile);
+        for (int y = bounds.top; y < bounds.bottom; y++)
+        {
+            for (int x = bounds.left; x < bounds.right; x++)
+            {
+                // Sample at pixel centers, no anti-aliasing so neighboring
+                // triangles meet without seams.
+                Vec2D p(x + 0.5f, y + 0.5f);
+                float wa = Vec2D::cross(c - b, p - b) * inverseArea;
+                float wb = Vec2D::cross(a - c, p - c) * inverseArea;
+                float wc = 1.0f - wa - wb;
+                if (wa < 0.0f || wb < 0.0f || wc < 0.0f)
+                {
+                    continue;
+                }
+                float coverage = 1.0f;
+                if (clipMask != nullptr)
+                {
+                    coverage = clipMask[(y - tile.top) * tile.width() + (x - tile.left)];
+                    if (coverage <= 0.0f)
+                    {
+                        continue;
+                    }
+                }
+                Vec2D uv = command.uvs[ia] * wa + command.uvs[ib] * wb + command.uvs[ic] * wc;
+                Vec2D position(uv.x * imageSize.x, uv.y * imageSize.y);
+                blendPixel(&pixels[((size_t)y * stride + x) * 4],
+                           command.blendMode,
+                           image->sample(position) * command.opacity,
+                           coverage);
+            }
+        }
+    }
+}
+
+static void renderTile(const std::vector<std::unique_ptr<DrawCommand>>& commands,
+                       uint8_t* pixels,
+                       uint32_t stride,
+                       const IAABB& tile,
+                       TileScratch& scratch)
+{
+    int width = tile.width();
+    scratch.clipState = nullptr;
+    for (const auto& commandPtr : commands)
+    {
+        const DrawCommand& command = *commandPtr;
+        if (intersect(command.bounds, tile).empty())
+        {
+            continue;
+        }
+        const float* clipMask = nullptr;
+        if (command.clip != nullptr)
+        {
+            if (scratch.clipState != command.clip.get())
+            {
+                buildClipMask(command.clip.get(), tile, scratch);
+                scratch.clipState = command.clip.get();
+            }
+            clipMask = scratch.clipMask.data();
+        }
+
+        if (command.type == DrawCommand::Type::mesh)
+        {
+            drawMesh(command, pixels, stride, tile, clipMask);
+            continue;
+        }
+
+        IAABB touched = scratch.rasterizer.rasterize(command.polygon,
+                                                     command.fillRule,
+                                                     tile,
+                                                     scratch.coverage.data());
+        for (int y = touched.top; y < touched.bottom; y++)
+        {
+            const float* coverageRow = &scratch.coverage[y * width];
+            const float* clipRow = clipMask != nullptr ? &clipMask[y * width] : nullptr;
+            int deviceY = tile.top + y;
+            uint8_t* row = &pixels[((size_t)deviceY * stride + tile.left) * 4];
+            for (int x = touched.left; x < touched.right; x++)
+            {
+                float coverage = coverageRow[x];
+                if (clipRow != nullptr)
+                {
+                    coverage *= clipRow[x];
+                }
+                if (coverage <= 0.0f)
+                {
+                    continue;
+                }
+                blendPixel(&row[x * 4],
+                           command.blendMode,
+                           shade(command, tile.left + x, deviceY),
+                           coverage);
+            }
+        }
+    }
+}
+
+// Renderer
+
+SoftwareRenderer::SoftwareRenderer(uint32_t width, uint32_t height, uint32_t threadCount) :
+    m_width(width),
+    m_height(height),
+    m_threadCount(std::max(1u, threadCount)),
+    m_pixels((size_t)width * height * 4, 0)
+{
+    m_stack.push_back(State());
+}
+
+SoftwareRenderer::~SoftwareRenderer() {}
+
+void SoftwareRenderer::clear(ColorInt color)
+{
+    m_commands.clear();
+    float4 premultiplied = premultipliedColor(color);
+    auto rgba = simd::cast<uint8_t>(premultiplied * 255.0f + 0.5f);
+    for (size_t i = 0; i < m_pixels.size(); i += 4)
+    {
+        simd::store(&m_pixels[i], rgba);
+    }
+}
+
+ColorInt SoftwareRenderer::pixel(uint32_t x, uint32_t y) const
+{
+    const uint8_t* rgba = &m_pixels[((size_t)y * m_width + x) * 4];
+    return colorARGB(rgba[3], rgba[0], rgba[1], rgba[2]);
+}
+
+void SoftwareRenderer::flush()
+{
+    if (m_commands.empty())
+    {
+        return;
+    }
+    int tilesX = ((int)m_width + kTileSize - 1) / kTileSize;
+    int tilesY = ((int)m_height + kTileSize - 1) / kTileSize;
+    int tileCount = tilesX * tilesY;
+    std::atomic<int> nextTile(0);
+    auto work = [&]() {
+        TileScratch scratch;
+        for (int index = nextTile++; index < tileCount; index = nextTile++)
+        {
+            int left = (index % tilesX) * kTileSize;
+            int top = (index / tilesX) * kTileSize;
+            IAABB tile = {left,
+                          top,
+                          std::min(left + kTileSize, (int)m_width),
+                          std::min(top + kTileSize, (int)m_height)};
+            renderTile(m_commands, m_pixels.data(), m_width, tile, scratch);
+        }
+    };
+
+    uint32_t threadCount = std::min(m_threadCount, (uint32_t)tileCount);
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < threadCount; i++)
+    {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    m_commands.clear();
+}
+
+void SoftwareRenderer::save() { m_stack.push_back(m_stack.back()); }
+
+void SoftwareRenderer::restore()
+{
+    if (m_stack.size() > 1)
+    {
+        m_stack.pop_back();
+    }
+}
+
+void SoftwareRenderer::transform(const Mat2D& transform)
+{
+    Mat2D& current = m_stack.back().transform;
+    current = current * transform;
+}
+
+void SoftwareRenderer::addCommand(std::unique_ptr<DrawCommand> command)
+{
+    const State& state = m_stack.back();
+    IAABB bounds = {0, 0, (int32_t)m_width, (int32_t)m_height};
+    if (command->type != DrawCommand::Type::mesh)
+    {
+        bounds = intersect(bounds, command->polygon.pixelBounds());
+    }
+    else
+    {
+        AABB meshBounds;
+        meshBounds.minX = meshBounds.minY = std::numeric_limits<float>::max();
+        meshBounds.maxX = meshBounds.maxY = -std::numeric_limits<float>::max();
+        for (const Vec2D& vertex : command->vertices)
+        {
+            meshBounds.minX = std::min(meshBounds.minX, vertex.x);
+            meshBounds.minY = std::min(meshBounds.minY, vertex.y);
+            meshBounds.maxX = std::max(meshBounds.maxX, vertex.x);
+            meshBounds.maxY = std::max(meshBounds.maxY, vertex.y);
+        }
+        if (!(meshBounds.minX <= meshBounds.maxX))
+        {
+            return;
+        }
+        bounds = intersect(bounds,
+                           {(int32_t)std::max(-1e7f, std::floor(meshBounds.minX)),
+                            (int32_t)std::max(-1e7f, std::floor(meshBounds.minY)),
+                            (int32_t)std::min(1e7f, std::ceil(meshBounds.maxX) + 1),
+                            (int32_t)std::min(1e7f, std::ceil(meshBounds.maxY) + 1)});
+    }
+    if (state.clip != nullptr)
+    {
+        bounds = intersect(bounds, state.clip->bounds);
+    }
+    if (bounds.empty())
+    {
+        return;
+    }
+    command->bounds = bounds;
+    command->clip = state.clip;
+    m_commands.push_back(std::move(command));
+}
+
+void SoftwareRenderer::drawPath(RenderPath* renderPath, RenderPaint* renderPaint)
+{
+    auto path = lite_rtti_cast<SoftwareRenderPath*>(renderPath);
+    auto paint = lite_rtti_cast<SoftwareRenderPaint*>(renderPaint);
+    if (path == nullptr || paint == nullptr)
+    {
+        return;
+    }
+    const Mat2D& transform = m_stack.back().transform;
+    std::unique_ptr<DrawCommand> command(new DrawCommand());
+    std::vector<Polyline> polylines;
+    if (paint->style() == RenderPaintStyle::stroke)
+    {
+        // Strokes are built in local space so the thickness scales with the
+        // transform.
+        float precision = kPrecision * std::max(transform.findMaxScale(), 1e-3f);
+        flatten(path->rawPath(), Mat2D(), precision, &polylines);
+        stroke(polylines,
+               paint->thickness(),
+               paint->join(),
+               paint->cap(),
+               precision,
+               transform,
+               &command->polygon);
+        command->fillRule = FillRule::nonZero;
+    }
+    else
+    {
+        flatten(path->rawPath(), transform, kPrecision, &polylines);
+        fill(polylines, &command->polygon);
+        command->fillRule = path->fillRule();
+    }
+    command->blendMode = paint->blendMode();
+    command->color = premultipliedColor(paint->color());
+    command->shader = paint->shader();
+    command->inverseTransform = transform.invertOrIdentity();
+    addCommand(std::move(command));
+}
+
+void SoftwareRenderer::clipPath(RenderPath* renderPath)
+{
+    auto path = lite_rtti_cast<SoftwareRenderPath*>(renderPath);
+    if (path == nullptr)
+    {
+        return;
+    }
+    State& state = m_stack.back();
+    auto clip = std::make_shared<ClipState>();
+    std::vector<Polyline> polylines;
+    flatten(path->rawPath(), state.transform, kPrecision, &polylines);
+    fill(polylines, &clip->polygon);
+    clip->fillRule = path->fillRule();
+    clip->bounds = intersect({0, 0, (int32_t)m_width, (int32_t)m_height},
+                             clip->polygon.pixelBounds());
+    if (state.clip != nullptr)
+    {
+        clip->bounds = intersect(clip->bounds, state.clip->bounds);
+    }
+    clip->parent = state.clip;
+    state.clip = clip;
+}
+
+void SoftwareRenderer::drawImage(const RenderImage* renderImage,
+                                 BlendMode blendMode,
+                                 float opacity)
+{
+    auto image = lite_rtti_cast<const SoftwareRenderImage*>(renderImage);
+    if (image == nullptr)
+    {
+        return;
+    }
+    const Mat2D& transform = m_stack.back().transform;
+    std::unique_ptr<DrawCommand> command(new DrawCommand());
+    command->type = DrawCommand::Type::image;
+    float width = (float)image->width();
+    float height = (float)image->height();
+    Vec2D corners[4] = {transform * Vec2D(0.0f, 0.0f),
+                        transform * Vec2D(width, 0.0f),
+                        transform * Vec2D(width, height),
+                        transform * Vec2D(0.0f, height)};
+    command->polygon.addContour(corners, 4);
+    command->blendMode = blendMode;
+    command->image = ref_rcp(const_cast<SoftwareRenderImage*>(image));
+    command->opacity = opacity;
+    command->inverseTransform = transform.invertOrIdentity();
+    addCommand(std::move(command));
+}
+
+void SoftwareRenderer::drawImageMesh(const RenderImage* renderImage,
+                                     rcp<RenderBuffer> vertices_f32,
+                                     rcp<RenderBuffer> uvCoords_f32,
+                                     rcp<RenderBuffer> indices_u16,
+                                     uint32_t vertexCount,
+                                     uint32_t indexCount,
+                                     BlendMode blendMode,
+                                     float opacity)
+{
+    auto image = lite_rtti_cast<const SoftwareRenderImage*>(renderImage);
+    auto vertices = lite_rtti_cast<SoftwareRenderBuffer*>(vertices_f32.get());
+    auto uvs = lite_rtti_cast<SoftwareRenderBuffer*>(uvCoords_f32.get());
+    auto indices = lite_rtti_cast<SoftwareRenderBuffer*>(indices_u16.get());
+    if (image == nullptr || vertices == nullptr || uvs == nullptr || indices == nullptr ||
+        vertices->sizeInBytes() < vertexCount * sizeof(Vec2D) ||
+        uvs->sizeInBytes() < vertexCount * sizeof(Vec2D) ||
+        indices->sizeInBytes() < indexCount * sizeof(uint16_t))
+    {
+        return;
+    }
+    const Mat2D& transform = m_stack.back().transform;
+    std::unique_ptr<DrawCommand> command(new DrawCommand());
+    command->type = DrawCommand::Type::mesh;
+    const Vec2D* localVertices = reinterpret_cast<const Vec2D*>(vertices->bytes());
+    const Vec2D* localUVs = reinterpret_cast<const Vec2D*>(uvs->bytes());
+    const uint16_t* localIndices = reinterpret_cast<const uint16_t*>(indices->bytes());
+    command->vertices.reserve(vertexCount);
+    for (uint32_t i = 0; i < vertexCount; i++)
+    {
+        command->vertices.push_back(transform * localVertices[i]);
+    }
+    command->uvs.assign(localUVs, localUVs + vertexCount);
+    command->indices.assign(localIndices, localIndices + indexCount);
+    command->blendMode = blendMode;
+    command->image = ref_rcp(const_cast<SoftwareRenderImage*>(image));
+    command->opacity = opacity;
+    addCommand(std::move(command));
+}
@@ -1,5 +1,6 @@
 #include "rive/animation/blend_state.hpp"
 #include "rive/animation/blend_animation.hpp"
+#include "rive/memory_footprint.hpp"
 
 using namespace rive;
 
@@ -16,4 +17,14 @@ void BlendState::addAnimation(BlendAnimation* animation)
     // Assert it's not already contained.
     assert(std::find(m_Animations.begin(), m_Animations.end(), animation) == m_Animations.end());
     m_Animations.push_back(animation);
-}
\ No newline at end of file
+}
+
+void BlendState::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    footprint.coreObjects += MemoryFootprint::capacityBytes(m_Animations);
+    for (auto animation : m_Animations)
+    {
+        animation->addMemoryFootprint(footprint);
+    }
+}
@@ -4,6 +4,7 @@
 #include "rive/artboard.hpp"
 #include "rive/importers/linear_animation_importer.hpp"
 #include "rive/generated/core_registry.hpp"
+#include "rive/memory_footprint.hpp"
 
 using namespace rive;
 
@@ -95,4 +96,24 @@ StatusCode KeyedObject::import(ImportStack& importStack)
     // we transfer ownership of ourself to the importer!
     importer->addKeyedObject(std::unique_ptr<KeyedObject>(this));
     return Super::import(importStack);
-}
\ No newline at end of file
+}
+
+size_t KeyedObject::keyFrameCount() const
+{
+    size_t count = 0;
+    for (const auto& property : m_keyedProperties)
+    {
+        count += property->keyFrameCount();
+    }
+    return count;
+}
+
+void KeyedObject::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    footprint.keyframes +=
+        MemoryFootprint::objectSize(this) + MemoryFootprint::capacityBytes(m_keyedProperties);
+    for (const auto& property : m_keyedProperties)
+    {
+        property->addMemoryFootprint(footprint);
+    }
+}
@@ -5,6 +5,7 @@
 #include "rive/animation/keyed_callback_reporter.hpp"
 #include "rive/importers/import_stack.hpp"
 #include "rive/importers/keyed_object_importer.hpp"
+#include "rive/memory_footprint.hpp"
 
 using namespace rive;
 
@@ -172,3 +173,13 @@ StatusCode KeyedProperty::import(ImportStack& importStack)
     importer->addKeyedProperty(std::unique_ptr<KeyedProperty>(this));
     return Super::import(importStack);
 }
+
+void KeyedProperty::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    footprint.keyframes +=
+        MemoryFootprint::objectSize(this) + MemoryFootprint::capacityBytes(m_keyFrames);
+    for (const auto& keyFrame : m_keyFrames)
+    {
+        keyFrame->addMemoryFootprint(footprint);
+    }
+}
@@ -4,6 +4,7 @@
 #include "rive/core_context.hpp"
 #include "rive/importers/import_stack.hpp"
 #include "rive/importers/keyed_property_importer.hpp"
+#include "rive/memory_footprint.hpp"
 
 using namespace rive;
 
@@ -18,4 +19,9 @@ StatusCode KeyFrame::import(ImportStack& importStack)
     }
     importer->addKeyFrame(std::unique_ptr<KeyFrame>(this));
     return Super::import(importStack);
-}
\ No newline at end of file
+}
+
+void KeyFrame::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    footprint.keyframes += MemoryFootprint::objectSize(this);
+}
@@ -5,6 +5,7 @@
 #include "rive/generated/animation/state_machine_layer_base.hpp"
 #include "rive/animation/state_transition.hpp"
 #include "rive/animation/system_state_instance.hpp"
+#include "rive/memory_footprint.hpp"
 
 using namespace rive;
 
@@ -59,4 +60,14 @@ void LayerState::addTransition(StateTransition* transition) { m_Transitions.push
 std::unique_ptr<StateInstance> LayerState::makeInstance(ArtboardInstance* instance) const
 {
     return rivestd::make_unique<SystemStateInstance>(this, instance);
-}
\ No newline at end of file
+}
+
+void LayerState::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    footprint.coreObjects += MemoryFootprint::capacityBytes(m_Transitions);
+    for (auto transition : m_Transitions)
+    {
+        transition->addMemoryFootprint(footprint);
+    }
+}
@@ -4,6 +4,7 @@
 #include "rive/artboard.hpp"
 #include "rive/importers/artboard_importer.hpp"
 #include "rive/importers/import_stack.hpp"
+#include "rive/memory_footprint.hpp"
 #include <cmath>
 
 using namespace rive;
@@ -137,4 +138,24 @@ void LinearAnimation::reportKeyedCallbacks(KeyedCallbackReporter* reporter,
             object->reportKeyedCallbacks(reporter, secondsFrom, secondsTo, isAtStartFrame);
         }
     }
-}
\ No newline at end of file
+}
+
+size_t LinearAnimation::keyFrameCount() const
+{
+    size_t count = 0;
+    for (const auto& keyedObject : m_KeyedObjects)
+    {
+        count += keyedObject->keyFrameCount();
+    }
+    return count;
+}
+
+void LinearAnimation::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    footprint.keyframes += MemoryFootprint::capacityBytes(m_KeyedObjects);
+    for (const auto& keyedObject : m_KeyedObjects)
+    {
+        keyedObject->addMemoryFootprint(footprint);
+    }
+}
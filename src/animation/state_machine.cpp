@@ -4,6 +4,7 @@
 #include "rive/animation/state_machine_layer.hpp"
 #include "rive/animation/state_machine_input.hpp"
 #include "rive/animation/state_machine_listener.hpp"
+#include "rive/memory_footprint.hpp"
 
 using namespace rive;
 
@@ -140,4 +141,24 @@ const StateMachineListener* StateMachine::listener(size_t index) const
         return m_Listeners[index].get();
     }
     return nullptr;
-}
\ No newline at end of file
+}
+
+void StateMachine::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    footprint.coreObjects += MemoryFootprint::capacityBytes(m_Layers) +
+                             MemoryFootprint::capacityBytes(m_Inputs) +
+                             MemoryFootprint::capacityBytes(m_Listeners);
+    for (const auto& layer : m_Layers)
+    {
+        layer->addMemoryFootprint(footprint);
+    }
+    for (const auto& input : m_Inputs)
+    {
+        input->addMemoryFootprint(footprint);
+    }
+    for (const auto& listener : m_Listeners)
+    {
+        listener->addMemoryFootprint(footprint);
+    }
+}
@@ -26,6 +26,9 @@
 #include "rive/shapes/shape.hpp"
 #include "rive/math/math_types.hpp"
 #include "rive/audio_event.hpp"
+#include "rive/trace.hpp"
+#include <algorithm>
+#include <limits>
 #include <unordered_map>
 #include <chrono>
 
@@ -52,10 +55,6 @@ public:
         m_anyStateInstance = layer->anyState()->makeInstance(instance).release();
         m_layer = layer;
         changeState(m_layer->entryState());
-        auto now = std::chrono::high_resolution_clock::now();
-        auto nanos =
-            std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
-        srand(nanos);
     }
 
     void updateMix(float seconds)
@@ -151,8 +150,6 @@ public:
         return !((m_currentState == nullptr ? nullptr : m_currentState->state()) == stateTo);
     }
 
-    double randomValue() { return ((double)rand() / (RAND_MAX)); }
-
     bool changeState(const LayerState* stateTo)
     {
         if ((m_currentState == nullptr ? nullptr : m_currentState->state()) == stateTo)
@@ -168,6 +165,7 @@ public:
 
         m_currentState =
             stateTo == nullptr ? nullptr : stateTo->makeInstance(m_artboardInstance).release();
+        m_stateMachineInstance->m_stats.stateTransitions++;
 
         // Fire start events for the state we're changing to.
         if (m_currentState != nullptr)
@@ -203,7 +201,7 @@ public:
         }
         if (totalWeight > 0)
         {
-            double randomWeight = randomValue() * totalWeight * 1.0;
+            double randomWeight = m_stateMachineInstance->randomValue() * totalWeight * 1.0;
             float currentWeight = 0;
             size_t index = 0;
             StateTransition* transition;
@@ -561,6 +559,10 @@ HitResult StateMachineInstance::updateListeners(Vec2D position, ListenerType hit
 
         // TODO: quick reject.
 
+        if (!hitOpaque)
+        {
+            m_stats.hitTests++;
+        }
         HitResult hitResult = hitShape->processEvent(position, hitType, !hitOpaque);
         if (hitResult != HitResult::none)
         {
@@ -595,6 +597,13 @@ StateMachineInstance::StateMachineInstance(const StateMachine* machine,
                                            ArtboardInstance* instance) :
     Scene(instance), m_machine(machine)
 {
+    // Seed from the clock (and our address so instances created in the same
+    // tick diverge), callers wanting reproducible runs can call seedRandom.
+    auto now = std::chrono::high_resolution_clock::now();
+    auto nanos =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+    m_random.seed((uint64_t)nanos ^ (uint64_t)(uintptr_t)this);
+
     const auto count = machine->inputCount();
     m_inputInstances.resize(count);
     for (size_t i = 0; i < count; i++)
@@ -702,41 +711,25 @@ StateMachineInstance::~StateMachineInstance()
 
 void StateMachineInstance::sortHitComponents()
 {
-    Drawable* last = m_artboardInstance->firstDrawable();
-    if (last)
-    {
-        // walk to the end, so we can visit in reverse-order
-        while (last->prev)
-        {
-            last = last->prev;
-        }
-    }
-    auto hitShapesCount = m_hitComponents.size();
-    auto currentSortedIndex = 0;
-    for (auto drawable = last; drawable; drawable = drawable->next)
-    {
-        for (size_t i = currentSortedIndex; i < hitShapesCount; i++)
-        {
-            if (m_hitComponents[i]->component() == drawable)
-            {
-                if (currentSortedIndex != i)
-                {
-                    std::iter_swap(m_hitComponents.begin() + currentSortedIndex,
-                                   m_hitComponents.begin() + i);
-                }
-                currentSortedIndex++;
-                break;
-            }
-        }
-        if (currentSortedIndex == hitShapesCount)
-        {
-            break;
-        }
-    }
+    // Hit components follow the artboard's draw order (bottom-most first).
+    // Each drawable knows its index in that order so this is a plain sort
+    // instead of a walk of the drawable list per component.
+    auto drawOrderIndex = [](const std::unique_ptr<HitComponent>& hitComponent) {
+        auto component = hitComponent->component();
+        return component->is<Drawable>() ? component->as<Drawable>()->drawOrderIndex()
+                                         : std::numeric_limits<uint32_t>::max();
+    };
+    std::stable_sort(m_hitComponents.begin(),
+                     m_hitComponents.end(),
+                     [&](const std::unique_ptr<HitComponent>& a,
+                         const std::unique_ptr<HitComponent>& b) {
+                         return drawOrderIndex(a) < drawOrderIndex(b);
+                     });
 }
 
 bool StateMachineInstance::advance(float seconds)
 {
+    RIVE_TRACE_SCOPE_OBJECT("StateMachineInstance::advance", m_machine->name());
     if (m_artboardInstance->hasChangedDrawOrderInLastUpdate())
     {
         sortHitComponents();
@@ -768,6 +761,30 @@ bool StateMachineInstance::advanceAndApply(float seconds)
 }
 
 void StateMachineInstance::markNeedsAdvance() { m_needsAdvance = true; }
+
+double StateMachineInstance::randomValue() { return m_random.nextDouble(); }
+
+void StateMachineInstance::seedRandom(uint64_t seed)
+{
+    m_random.seed(seed);
+    // Derive seeds for nested state machines from ours so that the whole
+    // hierarchy replays deterministically from a single seed.
+    for (auto nestedArtboard : m_artboardInstance->nestedArtboards())
+    {
+        for (auto animation : nestedArtboard->nestedAnimations())
+        {
+            if (animation->is<NestedStateMachine>())
+            {
+                auto nestedInstance = animation->as<NestedStateMachine>()->stateMachineInstance();
+                if (nestedInstance != nullptr)
+                {
+                    uint64_t nestedSeed = m_random.nextU32();
+                    nestedInstance->seedRandom((nestedSeed << 32) | m_random.nextU32());
+                }
+            }
+        }
+    }
+}
 bool StateMachineInstance::needsAdvance() const { return m_needsAdvance; }
 
 std::string StateMachineInstance::name() const { return m_machine->name(); }
@@ -5,6 +5,7 @@
 #include "rive/animation/any_state.hpp"
 #include "rive/animation/entry_state.hpp"
 #include "rive/animation/exit_state.hpp"
+#include "rive/memory_footprint.hpp"
 
 using namespace rive;
 
@@ -74,3 +75,13 @@ StatusCode StateMachineLayer::import(ImportStack& importStack)
     stateMachineImporter->addLayer(std::unique_ptr<StateMachineLayer>(this));
     return Super::import(importStack);
 }
+
+void StateMachineLayer::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    footprint.coreObjects += MemoryFootprint::capacityBytes(m_States);
+    for (auto state : m_States)
+    {
+        state->addMemoryFootprint(footprint);
+    }
+}
@@ -6,6 +6,7 @@
 #include "rive/shapes/shape.hpp"
 #include "rive/animation/state_machine_instance.hpp"
 #include "rive/animation/listener_input_change.hpp"
+#include "rive/memory_footprint.hpp"
 
 using namespace rive;
 
@@ -82,4 +83,15 @@ void StateMachineListener::performChanges(StateMachineInstance* stateMachineInst
     {
         action->perform(stateMachineInstance, position, previousPosition);
     }
-}
\ No newline at end of file
+}
+
+void StateMachineListener::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    footprint.coreObjects += MemoryFootprint::capacityBytes(m_HitShapesIds) +
+                             MemoryFootprint::capacityBytes(m_Actions);
+    for (const auto& action : m_Actions)
+    {
+        action->addMemoryFootprint(footprint);
+    }
+}
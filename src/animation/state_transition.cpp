@@ -11,6 +11,7 @@
 #include "rive/animation/state_machine_instance.hpp"
 #include "rive/importers/import_stack.hpp"
 #include "rive/importers/layer_state_importer.hpp"
+#include "rive/memory_footprint.hpp"
 
 using namespace rive;
 
@@ -212,4 +213,14 @@ bool StateTransition::applyExitCondition(StateInstance* from) const
         return true;
     }
     return useExitTime;
-}
\ No newline at end of file
+}
+
+void StateTransition::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    footprint.coreObjects += MemoryFootprint::capacityBytes(m_Conditions);
+    for (auto condition : m_Conditions)
+    {
+        condition->addMemoryFootprint(footprint);
+    }
+}
@@ -20,6 +20,7 @@
 #include "rive/text/text_value_run.hpp"
 #include "rive/event.hpp"
 #include "rive/assets/audio_asset.hpp"
+#include "rive/trace.hpp"
 
 #include <unordered_map>
 
@@ -79,6 +80,7 @@ StatusCode Artboard::initialize()
     // these will be re-built in update() -- are they needed here?
     m_BackgroundPath = factory()->makeEmptyRenderPath();
     m_ClipPath = factory()->makeEmptyRenderPath();
+    m_Stats.renderPathsCreated += 2;
 
     // onAddedDirty guarantees that all objects are now available so they can be
     // looked up by index/id. This is where nodes find their parents, but they
@@ -224,7 +226,11 @@ StatusCode Artboard::initialize()
         }
     }
 
-    sortDependencies();
+    // Every instance initializes, reuse the thread's sorter (and its scratch
+    // storage) rather than reallocating it for each. sort() clears it before
+    // use.
+    static thread_local DependencySorter sorter;
+    sortDependencies(sorter);
 
     std::vector<DrawRules*> rulesList;
     // Build the rules in the right order. We use the map componentDrawRules
@@ -271,7 +277,6 @@ StatusCode Artboard::initialize()
             }
         }
     }
-    DependencySorter sorter;
     std::vector<Component*> drawTargetOrder;
     sorter.sort(&root, drawTargetOrder);
     auto itr = drawTargetOrder.begin();
@@ -373,11 +378,26 @@ void Artboard::sortDrawOrder()
     }
 
     m_FirstDrawable = lastDrawable;
+
+    // Stamp each drawable with its position so consumers (like hit testing)
+    // can sort by draw order without walking the list.
+    Drawable* bottom = m_FirstDrawable;
+    if (bottom)
+    {
+        while (bottom->prev)
+        {
+            bottom = bottom->prev;
+        }
+    }
+    uint32_t index = 0;
+    for (auto drawable = bottom; drawable; drawable = drawable->next)
+    {
+        drawable->m_DrawOrderIndex = index++;
+    }
 }
 
-void Artboard::sortDependencies()
+void Artboard::sortDependencies(DependencySorter& sorter)
 {
-    DependencySorter sorter;
     sorter.sort(this, m_DependencyOrder);
     unsigned int graphOrder = 0;
     for (auto component : m_DependencyOrder)
@@ -451,6 +471,7 @@ void Artboard::update(ComponentDirt value)
         }
         m_ClipPath = factory()->makeRenderPath(clip);
         m_BackgroundPath = factory()->makeRenderPath(bg);
+        m_Stats.renderPathsCreated += 2;
     }
     if (hasDirt(value, ComponentDirt::RenderOpacity))
     {
@@ -462,6 +483,7 @@ bool Artboard::updateComponents()
 {
     if (hasDirt(ComponentDirt::Components))
     {
+        RIVE_TRACE_SCOPE_OBJECT("Artboard::updateComponents", name());
         const int maxSteps = 100;
         int step = 0;
         auto count = m_DependencyOrder.size();
@@ -483,6 +505,7 @@ bool Artboard::updateComponents()
                 }
                 component->m_Dirt = ComponentDirt::None;
                 component->update(d);
+                m_Stats.componentsUpdated++;
 
                 // If the update changed the dirt depth by adding dirt
                 // to something before us (in the DAG), early out and
@@ -580,6 +603,7 @@ Core* Artboard::hitTest(HitInfo* hinfo, const Mat2D* xform)
 
 void Artboard::draw(Renderer* renderer, DrawOption option)
 {
+    RIVE_TRACE_SCOPE_OBJECT("Artboard::draw", name());
     renderer->save();
     if (clip())
     {
@@ -606,7 +630,7 @@ void Artboard::draw(Renderer* renderer, DrawOption option)
     {
         for (auto drawable = m_FirstDrawable; drawable != nullptr; drawable = drawable->prev)
         {
-            if (drawable->isHidden())
+            if (drawable->isHidden() || (m_HasViewport && drawable->isOutside(m_Viewport)))
             {
                 continue;
             }
@@ -617,6 +641,32 @@ void Artboard::draw(Renderer* renderer, DrawOption option)
     renderer->restore();
 }
 
+void Artboard::viewport(const AABB& value)
+{
+    if (!m_HasViewport || m_Viewport != value)
+    {
+        // Nested artboards paused offscreen may have come into view.
+        m_Dirt |= ComponentDirt::Components;
+    }
+    m_HasViewport = true;
+    m_Viewport = value;
+}
+
+void Artboard::clearViewport()
+{
+    if (m_HasViewport)
+    {
+        m_Dirt |= ComponentDirt::Components;
+    }
+    m_HasViewport = false;
+}
+
+void Artboard::offscreenNestedAdvance(OffscreenAdvance value, float throttleSeconds)
+{
+    m_OffscreenNestedAdvance = value;
+    m_OffscreenThrottleSeconds = throttleSeconds;
+}
+
 void Artboard::addToRenderPath(RenderPath* path, const Mat2D& transform)
 {
     for (auto drawable = m_FirstDrawable; drawable != nullptr; drawable = drawable->prev)
@@ -829,20 +879,114 @@ StatusCode Artboard::import(ImportStack& importStack)
     return result;
 }
 
+void Artboard::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    footprint.coreObjects += MemoryFootprint::capacityBytes(m_Objects) +
+                             MemoryFootprint::capacityBytes(m_Animations) +
+                             MemoryFootprint::capacityBytes(m_StateMachines) +
+                             MemoryFootprint::capacityBytes(m_DependencyOrder) +
+                             MemoryFootprint::capacityBytes(m_Drawables) +
+                             MemoryFootprint::capacityBytes(m_DrawTargets) +
+                             MemoryFootprint::capacityBytes(m_NestedArtboards) +
+                             MemoryFootprint::capacityBytes(m_Joysticks);
+    if (m_BackgroundPath != nullptr)
+    {
+        footprint.renderPaths += m_BackgroundPath->byteSize();
+    }
+    if (m_ClipPath != nullptr)
+    {
+        footprint.renderPaths += m_ClipPath->byteSize();
+    }
+    for (auto object : m_Objects)
+    {
+        if (object != nullptr && object != this)
+        {
+            object->addMemoryFootprint(footprint);
+        }
+    }
+    // Instances share their source's animations and state machines.
+    if (!m_IsInstance)
+    {
+        for (auto animation : m_Animations)
+        {
+            animation->addMemoryFootprint(footprint);
+        }
+        for (auto stateMachine : m_StateMachines)
+        {
+            stateMachine->addMemoryFootprint(footprint);
+        }
+    }
+}
+
+MemoryFootprint Artboard::memoryFootprint() const
+{
+    MemoryFootprint footprint;
+    addMemoryFootprint(footprint);
+    return footprint;
+}
+
 float Artboard::volume() const { return m_volume; }
 void Artboard::volume(float value)
 {
     m_volume = value;
     for (auto nestedArtboard : m_NestedArtboards)
     {
+        // Shared instances have no audio and are read only.
         auto artboard = nestedArtboard->artboard();
-        if (artboard != nullptr)
+        if (artboard != nullptr && !nestedArtboard->isSharedInstance())
         {
             artboard->volume(value);
         }
     }
 }
 
+namespace
+{
+// Draws nothing, used to run a first draw for its side effects.
+class PrimingRenderer : public Renderer
+{
+public:
+    void save() override {}
+    void restore() override {}
+    void transform(const Mat2D&) override {}
+    void drawPath(RenderPath*, RenderPaint*) override {}
+    void clipPath(RenderPath*) override {}
+    void drawImage(const RenderImage*, BlendMode, float) override {}
+    void drawImageMesh(const RenderImage*,
+                       rcp<RenderBuffer>,
+                       rcp<RenderBuffer>,
+                       rcp<RenderBuffer>,
+                       uint32_t,
+                       uint32_t,
+                       BlendMode,
+                       float) override
+    {}
+};
+} // namespace
+
+std::shared_ptr<ArtboardInstance> Artboard::sharedInstance() const
+{
+    assert(!isInstance());
+    std::lock_guard<std::mutex> lock(m_SharedInstanceMutex);
+    std::shared_ptr<ArtboardInstance> shared = m_SharedInstance.lock();
+    if (shared == nullptr)
+    {
+        shared = instance();
+        if (shared != nullptr)
+        {
+            shared->frameOrigin(false);
+            shared->advance(0.0f);
+            // Build whatever drawing creates lazily (trimmed paths, mesh
+            // vertex buffers) now, so later draws only read the instance.
+            PrimingRenderer renderer;
+            shared->draw(&renderer);
+        }
+        m_SharedInstance = shared;
+    }
+    return shared;
+}
+
 ////////// ArtboardInstance
 
 #include "rive/animation/linear_animation_instance.hpp"
@@ -904,7 +1048,7 @@ void Artboard::audioEngine(rcp<AudioEngine> audioEngine)
     for (auto nestedArtboard : m_NestedArtboards)
     {
         auto artboard = nestedArtboard->artboard();
-        if (artboard != nullptr)
+        if (artboard != nullptr && !nestedArtboard->isSharedInstance())
         {
             artboard->audioEngine(audioEngine);
         }
@@ -3,6 +3,7 @@
 #include "rive/assets/font_asset.hpp"
 #include "rive/artboard.hpp"
 #include "rive/factory.hpp"
+#include "rive/memory_footprint.hpp"
 
 using namespace rive;
 
@@ -24,4 +25,13 @@ void FontAsset::font(rcp<Font> font)
     {
         static_cast<TextStyle*>(fileAssetReferencer)->addDirt(ComponentDirt::TextShape);
     }
-}
\ No newline at end of file
+}
+
+void FontAsset::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    if (m_font != nullptr)
+    {
+        footprint.fonts += m_font->byteSize();
+    }
+}
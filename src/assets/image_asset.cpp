@@ -1,6 +1,9 @@
 #include "rive/assets/image_asset.hpp"
 #include "rive/artboard.hpp"
 #include "rive/factory.hpp"
+#include "rive/memory_footprint.hpp"
+
+#include <cmath>
 
 using namespace rive;
 
@@ -11,13 +14,100 @@ bool ImageAsset::decode(SimpleArray<uint8_t>& data, Factory* factory)
 #ifdef TESTING
     decodedByteSize = data.size();
 #endif
+    probe(data);
     renderImage(factory->decodeImage(data));
     return m_RenderImage != nullptr;
 }
 
+// Largest maxDimension the image can be scaled to and still fit in bytes.
+static uint32_t fittingDimension(const ImageHeader& header, size_t bytes)
+{
+    uint32_t largest = std::max(header.width, header.height);
+    double scale = std::sqrt((double)bytes / (double)header.decodedByteSize());
+    uint32_t maxDimension = (uint32_t)(largest * scale);
+    while (maxDimension > 0)
+    {
+        uint32_t width, height;
+        ImageHeader::scaledSize(header.width, header.height, maxDimension, &width, &height);
+        if ((size_t)width * height * 4 <= bytes)
+        {
+            break;
+        }
+        maxDimension--;
+    }
+    return maxDimension;
+}
+
+bool ImageAsset::decode(SimpleArray<uint8_t>& data, Factory* factory, ImageBudget* budget)
+{
+    if (budget == nullptr || budget->maxBytes == 0)
+    {
+        return decode(data, factory);
+    }
+#ifdef TESTING
+    decodedByteSize = data.size();
+#endif
+    probe(data);
+    uint32_t maxDimension = 0;
+    if (m_ImageHeader.valid())
+    {
+        size_t remaining =
+            budget->maxBytes > budget->usedBytes ? budget->maxBytes - budget->usedBytes : 0;
+        if (m_ImageHeader.decodedByteSize() > remaining)
+        {
+            // A factory that can't scale would decode at full size and
+            // overshoot, defer instead.
+            bool downsample = budget->downsample && factory->canDecodeScaled();
+            maxDimension = downsample ? fittingDimension(m_ImageHeader, remaining) : 0;
+            if (!downsample || maxDimension < budget->minDimension)
+            {
+                m_DeferredBytes = std::move(data);
+                return false;
+            }
+        }
+    }
+    renderImage(factory->decodeScaledImage(data, maxDimension));
+    budget->usedBytes += decodedMemory();
+    return m_RenderImage != nullptr;
+}
+
+bool ImageAsset::decodeDeferred(Factory* factory, uint32_t maxDimension)
+{
+    if (m_DeferredBytes.empty())
+    {
+        return false;
+    }
+    renderImage(factory->decodeScaledImage(m_DeferredBytes, maxDimension));
+    m_DeferredBytes = SimpleArray<uint8_t>();
+    return m_RenderImage != nullptr;
+}
+
+void ImageAsset::probe(Span<const uint8_t> bytes) { ImageHeader::probe(bytes, &m_ImageHeader); }
+
+size_t ImageAsset::decodedMemory() const
+{
+    if (m_RenderImage == nullptr)
+    {
+        return 0;
+    }
+    return (size_t)m_RenderImage->width() * m_RenderImage->height() * 4;
+}
+
 void ImageAsset::renderImage(rcp<RenderImage> renderImage)
 {
     m_RenderImage = std::move(renderImage);
 }
 
 std::string ImageAsset::fileExtension() const { return "png"; }
+
+void ImageAsset::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    footprint.images += decodedMemory();
+    // Deferred images hold on to their encoded bytes, count what they'll
+    // take up once decoded too.
+    if (isDeferred())
+    {
+        footprint.images += m_DeferredBytes.size() + m_ImageHeader.decodedByteSize();
+    }
+}
@@ -19,15 +19,25 @@
 #include "rive/audio/audio_source.hpp"
 
 #include <algorithm>
+#include <cassert>
 #include <cmath>
 
 using namespace rive;
 
 void AudioEngine::SoundCompleted(void* pUserData, ma_sound* pSound)
 {
+    // This runs on the audio thread so it must not lock or allocate. The sound
+    // is still referenced by the playing list, so it's safe to take another
+    // reference for the queue here and let pump release it.
     AudioSound* audioSound = (AudioSound*)pUserData;
     auto engine = audioSound->m_engine;
-    engine->soundCompleted(ref_rcp(audioSound));
+    if (engine->m_completedQueue.full())
+    {
+        engine->m_completedQueueOverflowed.store(true, std::memory_order_release);
+        return;
+    }
+    audioSound->ref();
+    engine->m_completedQueue.push(audioSound);
 }
 
 void AudioEngine::unlinkSound(rcp<AudioSound> sound)
@@ -52,11 +62,59 @@ void AudioEngine::unlinkSound(rcp<AudioSound> sound)
     sound->m_prevPlaying = nullptr;
 }
 
-void AudioEngine::soundCompleted(rcp<AudioSound> sound)
+void AudioEngine::pump()
 {
     std::unique_lock<std::mutex> lock(m_mutex);
-    m_completedSounds.push_back(sound);
-    unlinkSound(sound);
+    disposeCompletedSounds();
+}
+
+void AudioEngine::disposeCompletedSounds()
+{
+    if (m_completedQueueOverflowed.exchange(false, std::memory_order_acquire))
+    {
+        auto sound = m_playingSoundsHead;
+        while (sound != nullptr)
+        {
+            auto next = sound->m_nextPlaying;
+            if (sound->completed())
+            {
+                unlinkSound(sound);
+                sound->m_isHandedOut = false;
+                m_completedSounds.push_back(sound);
+            }
+            sound = next;
+        }
+    }
+
+    // We have to dispose completed sounds out of the completed callback. Sounds
+    // retired by stop or the scan above may have raced their own completion
+    // onto the queue, once disposed nothing more gets queued for them.
+    for (auto& sound : m_completedSounds)
+    {
+        sound->dispose();
+    }
+
+    AudioSound* completed;
+    while (m_completedQueue.pop(completed))
+    {
+        // Adopt the reference taken in SoundCompleted.
+        rcp<AudioSound> sound(completed);
+        if (!sound->m_isHandedOut)
+        {
+            // Already retired.
+            continue;
+        }
+        unlinkSound(sound);
+        sound->m_isHandedOut = false;
+        sound->dispose();
+        m_completedSounds.push_back(std::move(sound));
+    }
+
+    for (auto& sound : m_completedSounds)
+    {
+        recycleVoice(std::move(sound));
+    }
+    m_completedSounds.clear();
 }
 
 #ifdef WITH_RIVE_AUDIO_TOOLS
@@ -188,7 +246,15 @@ uint32_t AudioEngine::sampleRate() const { return ma_engine_get_sample_rate(m_en
 
 AudioEngine::AudioEngine(ma_engine* engine) :
     m_device(ma_engine_get_device(engine)), m_engine(engine)
-{}
+{
+    m_freeVoices.reserve(m_voicePoolSize);
+    for (size_t i = 0; i < m_voicePoolSize; i++)
+    {
+        auto voice = rcp<AudioSound>(new AudioSound(this, nullptr, nullptr));
+        voice->m_isDisposed = true;
+        m_freeVoices.push_back(voice);
+    }
+}
 
 rcp<AudioSound> AudioEngine::play(rcp<AudioSource> source,
                                   uint64_t startTime,
@@ -203,36 +269,71 @@ rcp<AudioSound> AudioEngine::play(rcp<AudioSource> source,
     }
 
     std::unique_lock<std::mutex> lock(m_mutex);
-    // We have to dispose completed sounds out of the completed callback. So we
-    // do it on next play or at destruct.
-    for (auto sound : m_completedSounds)
+    disposeCompletedSounds();
+
+    rcp<DecodedAudio> decoded;
+    if (!source->isBuffered())
     {
-        sound->dispose();
+        uint64_t decodeFrames = 0;
+        decoded = cachedAudio(source, &decodeFrames);
+        if (decoded == nullptr && decodeFrames != 0)
+        {
+            // Decoding takes a while, don't hold up other plays or pump.
+            lock.unlock();
+            decoded = decodeAudio(source, decodeFrames);
+            lock.lock();
+            if (decoded != nullptr)
+            {
+                decoded = cacheAudio(source, std::move(decoded));
+            }
+        }
     }
-    m_completedSounds.clear();
 
-    rcp<AudioSound> audioSound = rcp<AudioSound>(new AudioSound(this, source, artboard));
-    if (source->isBuffered())
+    rcp<AudioSound> audioSound = acquireVoice(source, artboard);
+    if (source->isBuffered() || decoded != nullptr)
     {
-        rive::Span<float> samples = source->bufferedSamples();
-        ma_uint64 sizeInFrames = samples.size() / source->channels();
-        if (endTime != 0)
+        const float* samples;
+        uint32_t sampleChannels;
+        ma_uint64 sizeInFrames;
+        ma_uint64 clippedFrames = std::numeric_limits<ma_uint64>::max();
+        if (decoded != nullptr)
         {
-            float durationSeconds = (soundStartTime + endTime - startTime) / (float)sampleRate();
-            ma_uint64 clippedFrames = (ma_uint64)std::round(durationSeconds * source->sampleRate());
-            if (clippedFrames < sizeInFrames)
+            // Already decoded to the engine's format.
+            samples = decoded->samples.data();
+            sampleChannels = channels();
+            sizeInFrames = decoded->lengthInFrames;
+            if (endTime != 0)
             {
-                sizeInFrames = clippedFrames;
+                clippedFrames = soundStartTime + endTime - startTime;
             }
+            audioSound->m_decodedAudio = decoded;
+        }
+        else
+        {
+            rive::Span<float> bufferedSamples = source->bufferedSamples();
+            samples = bufferedSamples.data();
+            sampleChannels = source->channels();
+            sizeInFrames = bufferedSamples.size() / sampleChannels;
+            if (endTime != 0)
+            {
+                float durationSeconds =
+                    (soundStartTime + endTime - startTime) / (float)sampleRate();
+                clippedFrames = (ma_uint64)std::round(durationSeconds * source->sampleRate());
+            }
+        }
+        if (clippedFrames < sizeInFrames)
+        {
+            sizeInFrames = clippedFrames;
         }
         ma_audio_buffer_config config = ma_audio_buffer_config_init(ma_format_f32,
-                                                                    source->channels(),
+                                                                    sampleChannels,
                                                                     sizeInFrames,
-                                                                    (const void*)samples.data(),
+                                                                    (const void*)samples,
                                                                     nullptr);
         if (ma_audio_buffer_init(&config, audioSound->buffer()) != MA_SUCCESS)
         {
             fprintf(stderr, "AudioSource::play - Failed to initialize audio buffer.\n");
+            releaseVoice(std::move(audioSound));
             return nullptr;
         }
         if (ma_sound_init_from_data_source(m_engine,
@@ -241,6 +342,7 @@ rcp<AudioSound> AudioEngine::play(rcp<AudioSource> source,
                                            nullptr,
                                            audioSound->sound()) != MA_SUCCESS)
         {
+            releaseVoice(std::move(audioSound));
             return nullptr;
         }
     }
@@ -260,6 +362,7 @@ rcp<AudioSound> AudioEngine::play(rcp<AudioSource> source,
                                    &clip->decoder) != MA_SUCCESS)
         {
             fprintf(stderr, "AudioSource::play - Failed to initialize decoder.\n");
+            releaseVoice(std::move(audioSound));
             return nullptr;
         }
         clip->frameCursor = 0;
@@ -269,6 +372,7 @@ rcp<AudioSound> AudioEngine::play(rcp<AudioSource> source,
         baseConfig.vtable = &g_ma_end_clipped_decoder_vtable;
         if (ma_data_source_init(&baseConfig, &clip->base) != MA_SUCCESS)
         {
+            releaseVoice(std::move(audioSound));
             return nullptr;
         }
 
@@ -278,6 +382,7 @@ rcp<AudioSound> AudioEngine::play(rcp<AudioSource> source,
                                            nullptr,
                                            audioSound->sound()) != MA_SUCCESS)
         {
+            releaseVoice(std::move(audioSound));
             return nullptr;
         }
     }
@@ -302,9 +407,11 @@ rcp<AudioSound> AudioEngine::play(rcp<AudioSource> source,
     if (ma_sound_start(audioSound->sound()) != MA_SUCCESS)
     {
         fprintf(stderr, "AudioSource::play - failed to start sound\n");
+        releaseVoice(std::move(audioSound));
         return nullptr;
     }
 
+    audioSound->m_isHandedOut = true;
     if (m_playingSoundsHead != nullptr)
     {
         m_playingSoundsHead->m_prevPlaying = audioSound;
@@ -315,6 +422,159 @@ rcp<AudioSound> AudioEngine::play(rcp<AudioSource> source,
     return audioSound;
 }
 
+rcp<AudioSound> AudioEngine::acquireVoice(rcp<AudioSource> source, Artboard* artboard)
+{
+    if (m_freeVoices.empty())
+    {
+        return rcp<AudioSound>(new AudioSound(this, std::move(source), artboard));
+    }
+    rcp<AudioSound> sound = std::move(m_freeVoices.back());
+    m_freeVoices.pop_back();
+    sound->reset(std::move(source), artboard);
+    return sound;
+}
+
+void AudioEngine::releaseVoice(rcp<AudioSound> sound)
+{
+    // Uninitializes whatever play got to before failing.
+    sound->dispose();
+    recycleVoice(std::move(sound));
+}
+
+void AudioEngine::recycleVoice(rcp<AudioSound> sound)
+{
+    assert(!sound->m_isHandedOut);
+    if (m_freeVoices.size() < m_voicePoolSize)
+    {
+        m_freeVoices.push_back(std::move(sound));
+    }
+}
+
+void AudioEngine::voicePoolSize(size_t size)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_voicePoolSize = size;
+    if (m_freeVoices.size() > size)
+    {
+        m_freeVoices.resize(size);
+    }
+}
+
+void AudioEngine::decodeCacheLimits(size_t maxClipBytes, size_t maxCacheBytes)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_maxCachedClipBytes = maxClipBytes;
+    m_maxDecodeCacheBytes = maxCacheBytes;
+    trimDecodeCache(maxClipBytes == 0 ? 0 : maxCacheBytes);
+}
+
+void AudioEngine::trimDecodeCache(size_t maxBytes)
+{
+    while (m_decodeCacheBytes > maxBytes && !m_decodeCache.empty())
+    {
+        auto& entry = m_decodeCache.back();
+        m_decodeCacheBytes -= entry.audio->samples.size() * sizeof(float);
+        m_decodeCacheLookup.erase(entry.source.get());
+        m_decodeCache.pop_back();
+    }
+}
+
+rcp<DecodedAudio> AudioEngine::cachedAudio(const rcp<AudioSource>& source,
+                                           uint64_t* decodeFrames)
+{
+    auto itr = m_decodeCacheLookup.find(source.get());
+    if (itr != m_decodeCacheLookup.end())
+    {
+        m_decodeCache.splice(m_decodeCache.begin(), m_decodeCache, itr->second);
+        return itr->second->audio;
+    }
+
+    if (m_maxCachedClipBytes == 0)
+    {
+        return nullptr;
+    }
+    uint64_t sourceSampleRate = source->sampleRate();
+    uint64_t sourceFrames = source->lengthInFrames();
+    if (sourceSampleRate == 0 || sourceFrames == 0)
+    {
+        return nullptr;
+    }
+    // Estimate the decoded size, the resampler can produce a few extra frames.
+    uint64_t estimatedFrames = sourceFrames * sampleRate() / sourceSampleRate + 16;
+    uint64_t estimatedBytes = estimatedFrames * channels() * sizeof(float);
+    if (estimatedBytes <= m_maxCachedClipBytes && estimatedBytes <= m_maxDecodeCacheBytes)
+    {
+        *decodeFrames = estimatedFrames;
+    }
+    return nullptr;
+}
+
+rcp<DecodedAudio> AudioEngine::decodeAudio(const rcp<AudioSource>& source,
+                                           uint64_t estimatedFrames)
+{
+    uint32_t channelCount = channels();
+    ma_decoder decoder;
+    ma_decoder_config config = ma_decoder_config_init(ma_format_f32, channelCount, sampleRate());
+    auto sourceBytes = source->bytes();
+    if (ma_decoder_init_memory(sourceBytes.data(), sourceBytes.size(), &config, &decoder) !=
+        MA_SUCCESS)
+    {
+        return nullptr;
+    }
+
+    auto decoded = rcp<DecodedAudio>(new DecodedAudio());
+    std::vector<float>& samples = decoded->samples;
+    samples.resize((size_t)estimatedFrames * channelCount);
+    uint64_t framesDecoded = 0;
+    while (true)
+    {
+        uint64_t capacity = samples.size() / channelCount;
+        if (framesDecoded == capacity)
+        {
+            samples.resize(samples.size() + 1024 * channelCount);
+            capacity = samples.size() / channelCount;
+        }
+        ma_uint64 framesRead = 0;
+        ma_result result = ma_decoder_read_pcm_frames(&decoder,
+                                                      samples.data() + framesDecoded * channelCount,
+                                                      capacity - framesDecoded,
+                                                      &framesRead);
+        framesDecoded += framesRead;
+        if (result != MA_SUCCESS || framesRead == 0)
+        {
+            break;
+        }
+    }
+    ma_decoder_uninit(&decoder);
+
+    samples.resize((size_t)framesDecoded * channelCount);
+    samples.shrink_to_fit();
+    decoded->lengthInFrames = framesDecoded;
+    return decoded;
+}
+
+rcp<DecodedAudio> AudioEngine::cacheAudio(const rcp<AudioSource>& source,
+                                          rcp<DecodedAudio> decoded)
+{
+    auto itr = m_decodeCacheLookup.find(source.get());
+    if (itr != m_decodeCacheLookup.end())
+    {
+        m_decodeCache.splice(m_decodeCache.begin(), m_decodeCache, itr->second);
+        return itr->second->audio;
+    }
+    size_t bytes = decoded->samples.size() * sizeof(float);
+    // The limits may have changed while decoding, the clip still plays.
+    if (m_maxCachedClipBytes == 0 || bytes > m_maxDecodeCacheBytes)
+    {
+        return decoded;
+    }
+    trimDecodeCache(m_maxDecodeCacheBytes - bytes);
+    m_decodeCache.push_front({source, decoded});
+    m_decodeCacheLookup[source.get()] = m_decodeCache.begin();
+    m_decodeCacheBytes += bytes;
+    return decoded;
+}
+
 #ifdef TESTING
 size_t AudioEngine::playingSoundCount()
 {
@@ -329,6 +589,24 @@ size_t AudioEngine::playingSoundCount()
 
     return count;
 }
+
+size_t AudioEngine::decodeCacheCount()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_decodeCache.size();
+}
+
+size_t AudioEngine::decodeCacheBytes()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_decodeCacheBytes;
+}
+
+size_t AudioEngine::freeVoiceCount()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_freeVoices.size();
+}
 #endif
 
 void AudioEngine::stop(Artboard* artboard)
@@ -341,6 +619,7 @@ void AudioEngine::stop(Artboard* artboard)
         if (sound->m_artboard == artboard)
         {
             sound->stop();
+            sound->m_isHandedOut = false;
             m_completedSounds.push_back(sound);
             unlinkSound(sound);
         }
@@ -366,6 +645,15 @@ AudioEngine::~AudioEngine()
         sound->dispose();
     }
     m_completedSounds.clear();
+    // Sounds are disposed so the audio thread can't queue anything else.
+    AudioSound* completed;
+    while (m_completedQueue.pop(completed))
+    {
+        completed->unref();
+    }
+    m_freeVoices.clear();
+    m_decodeCache.clear();
+    m_decodeCacheLookup.clear();
 
     ma_engine_uninit(m_engine);
     delete m_engine;
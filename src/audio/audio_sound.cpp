@@ -12,10 +12,22 @@ AudioSound::AudioSound(AudioEngine* engine, rcp<AudioSource> source, Artboard* a
     m_sound({}),
     m_source(std::move(source)),
     m_isDisposed(false),
+    m_isHandedOut(false),
     m_engine(engine),
     m_artboard(artboard)
 {}
 
+void AudioSound::reset(rcp<AudioSource> source, Artboard* artboard)
+{
+    assert(m_isDisposed);
+    m_decoder = {};
+    m_buffer = {};
+    m_sound = {};
+    m_source = std::move(source);
+    m_isDisposed = false;
+    m_artboard = artboard;
+}
+
 void AudioSound::dispose()
 {
     if (m_isDisposed)
@@ -26,6 +38,7 @@ void AudioSound::dispose()
     ma_sound_uninit(&m_sound);
     ma_decoder_uninit(&m_decoder.decoder);
     ma_audio_buffer_uninit(&m_buffer);
+    m_decodedAudio = nullptr;
 }
 
 float AudioSound::volume() { return ma_sound_get_volume(&m_sound); }
@@ -13,6 +13,7 @@ AudioSource::AudioSource(rive::Span<float> samples, uint32_t numChannels, uint32
     m_isBuffered(true),
     m_channels(numChannels),
     m_sampleRate(sampleRate),
+    m_lengthInFrames(samples.size() / numChannels),
     m_ownedBytes((uint8_t*)samples.data(), samples.size() * sizeof(float))
 {
     assert(numChannels != 0);
@@ -20,13 +21,18 @@ AudioSource::AudioSource(rive::Span<float> samples, uint32_t numChannels, uint32
 }
 
 AudioSource::AudioSource(rive::Span<uint8_t> fileBytes) :
-    m_isBuffered(false), m_channels(0), m_sampleRate(0), m_fileBytes(fileBytes)
+    m_isBuffered(false),
+    m_channels(0),
+    m_sampleRate(0),
+    m_lengthInFrames(0),
+    m_fileBytes(fileBytes)
 {}
 
 AudioSource::AudioSource(rive::SimpleArray<uint8_t> fileBytes) :
     m_isBuffered(false),
     m_channels(0),
     m_sampleRate(0),
+    m_lengthInFrames(0),
     m_fileBytes(fileBytes.data(), fileBytes.size()),
     m_ownedBytes(std::move(fileBytes))
 {}
@@ -56,6 +62,16 @@ public:
 
     uint32_t sampleRate() { return (uint32_t)m_decoder.outputSampleRate; }
 
+    uint64_t lengthInFrames()
+    {
+        ma_uint64 length = 0;
+        if (ma_decoder_get_length_in_pcm_frames(&m_decoder, &length) != MA_SUCCESS)
+        {
+            return 0;
+        }
+        return (uint64_t)length;
+    }
+
 private:
     ma_decoder m_decoder;
 };
@@ -80,6 +96,16 @@ uint32_t AudioSource::sampleRate()
     return m_sampleRate = audioDecoder.sampleRate();
 }
 
+uint64_t AudioSource::lengthInFrames()
+{
+    if (m_lengthInFrames != 0)
+    {
+        return m_lengthInFrames;
+    }
+    AudioSourceDecoder audioDecoder(m_fileBytes);
+    return m_lengthInFrames = audioDecoder.lengthInFrames();
+}
+
 AudioFormat AudioSource::format() const
 {
     if (m_isBuffered)
@@ -154,6 +180,7 @@ AudioSource::AudioSource(rive::SimpleArray<uint8_t> fileBytes) {}
 AudioSource::AudioSource(rive::Span<float> samples, uint32_t numChannels, uint32_t sampleRate) {}
 uint32_t AudioSource::channels() { return 0; }
 uint32_t AudioSource::sampleRate() { return 0; }
+uint64_t AudioSource::lengthInFrames() { return 0; }
 AudioFormat AudioSource::format() const { return AudioFormat::unknown; }
 const rive::Span<float> AudioSource::bufferedSamples() const
 {
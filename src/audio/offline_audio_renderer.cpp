@@ -0,0 +1,73 @@
+#ifdef WITH_RIVE_AUDIO
+#ifdef EXTERNAL_RIVE_AUDIO_ENGINE
+#include "rive/audio/offline_audio_renderer.hpp"
+#include "rive/audio/audio_engine.hpp"
+#include "rive/artboard.hpp"
+#include "rive/scene.hpp"
+
+#include <cassert>
+#include <cmath>
+
+using namespace rive;
+
+OfflineAudioRenderer::OfflineAudioRenderer(Scene* scene,
+                                           rcp<AudioEngine> engine,
+                                           double framesPerSecond) :
+    m_scene(scene), m_engine(std::move(engine)), m_framesPerSecond(framesPerSecond)
+{
+    assert(framesPerSecond > 0.0);
+    m_scene->artboardInstance()->audioEngine(m_engine);
+}
+
+uint64_t OfflineAudioRenderer::audioFrameAt(uint64_t frame) const
+{
+    // Computed from the absolute frame so rounding never accumulates.
+    return (uint64_t)std::llround(frame * (double)m_engine->sampleRate() / m_framesPerSecond);
+}
+
+uint64_t OfflineAudioRenderer::nextAudioFrameCount() const
+{
+    return audioFrameAt(m_frame + 1) - audioFrameAt(m_frame);
+}
+
+uint64_t OfflineAudioRenderer::advance(Span<float> samples)
+{
+    uint64_t audioFrames = nextAudioFrameCount();
+    size_t channels = (size_t)m_engine->channels();
+    if (samples.size() < audioFrames * channels)
+    {
+        return 0;
+    }
+
+    // The first frame shows the scene at time 0, sounds it triggers start at
+    // the beginning of that frame's audio.
+    m_scene->advanceAndApply(m_frame == 0 ? 0.0f : (float)(1.0 / m_framesPerSecond));
+
+    uint64_t framesRead = 0;
+    if (!m_engine->readAudioFrames(samples.data(), audioFrames, &framesRead))
+    {
+        framesRead = 0;
+    }
+    // Pad anything the engine didn't produce with silence.
+    for (size_t i = framesRead * channels; i < audioFrames * channels; i++)
+    {
+        samples[i] = 0.0f;
+    }
+    m_engine->pump();
+    m_frame++;
+    return audioFrames;
+}
+
+void OfflineAudioRenderer::render(uint64_t frameCount, std::vector<float>& samples)
+{
+    size_t channels = (size_t)m_engine->channels();
+    for (uint64_t i = 0; i < frameCount; i++)
+    {
+        size_t offset = samples.size();
+        samples.resize(offset + nextAudioFrameCount() * channels);
+        advance(Span<float>(samples.data() + offset, samples.size() - offset));
+    }
+}
+
+#endif
+#endif
@@ -0,0 +1,161 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "rive/coalescing_renderer.hpp"
+
+using namespace rive;
+
+CoalescingRenderer::CoalescingRenderer(Renderer* backend) : m_backend(backend) {}
+
+CoalescingRenderer::~CoalescingRenderer() { restoreBackend(); }
+
+void CoalescingRenderer::restoreBackend() { popBackend(0); }
+
+size_t CoalescingRenderer::appliedPrefix() const
+{
+    size_t count = std::min(m_applied.size(), m_entries.size());
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!(m_applied[i].entry == m_entries[i]))
+        {
+            return i;
+        }
+    }
+    return count;
+}
+
+// Restores the backend until no more than count entries are applied. The
+// backend can only pop whole save levels so fewer may remain.
+void CoalescingRenderer::popBackend(size_t count)
+{
+    while (m_applied.size() > count)
+    {
+        size_t level = m_applied.size() - 1;
+        while (!m_applied[level].saved)
+        {
+            level--;
+        }
+        m_backend->restore();
+        m_counters.restore.forwarded++;
+        m_applied.resize(level);
+    }
+}
+
+void CoalescingRenderer::syncBackend()
+{
+    popBackend(appliedPrefix());
+    size_t start = m_applied.size();
+    for (size_t i = start; i < m_entries.size(); i++)
+    {
+        const Entry& entry = m_entries[i];
+        // Every clip gets its own save level, as does the run of transforms
+        // after it, so dropping a later entry never drops an earlier clip.
+        bool saved = i == start || entry.clip != nullptr || m_entries[i - 1].clip != nullptr;
+        if (saved)
+        {
+            m_backend->save();
+            m_counters.save.forwarded++;
+        }
+        if (entry.clip != nullptr)
+        {
+            m_backend->clipPath(entry.clip);
+            m_counters.clipPath.forwarded++;
+        }
+        else
+        {
+            m_backend->transform(entry.transform);
+            m_counters.transform.forwarded++;
+        }
+        m_applied.push_back({entry, ref_rcp(entry.clip), saved});
+    }
+}
+
+void CoalescingRenderer::save()
+{
+    m_counters.save.received++;
+    m_saves.push_back(m_entries.size());
+}
+
+void CoalescingRenderer::restore()
+{
+    m_counters.restore.received++;
+    if (m_saves.empty())
+    {
+        return;
+    }
+    m_entries.resize(m_saves.back());
+    m_saves.pop_back();
+    if (m_saves.empty())
+    {
+        // Leave the backend as balanced as the caller expects it to be.
+        popBackend(appliedPrefix());
+    }
+}
+
+void CoalescingRenderer::transform(const Mat2D& transform)
+{
+    m_counters.transform.received++;
+    if (transform == Mat2D())
+    {
+        return;
+    }
+    size_t levelStart = m_saves.empty() ? 0 : m_saves.back();
+    if (m_entries.size() > levelStart && m_entries.back().clip == nullptr)
+    {
+        // Concatenate with the previous transform in the same save level.
+        Mat2D& previous = m_entries.back().transform;
+        previous = previous * transform;
+        return;
+    }
+    Entry entry;
+    entry.transform = transform;
+    m_entries.push_back(entry);
+}
+
+void CoalescingRenderer::clipPath(RenderPath* path)
+{
+    m_counters.clipPath.received++;
+    if (path == nullptr)
+    {
+        return;
+    }
+    Entry entry;
+    entry.clip = path;
+    m_entries.push_back(entry);
+}
+
+void CoalescingRenderer::drawPath(RenderPath* path, RenderPaint* paint)
+{
+    syncBackend();
+    m_counters.draws++;
+    m_backend->drawPath(path, paint);
+}
+
+void CoalescingRenderer::drawImage(const RenderImage* image, BlendMode blendMode, float opacity)
+{
+    syncBackend();
+    m_counters.draws++;
+    m_backend->drawImage(image, blendMode, opacity);
+}
+
+void CoalescingRenderer::drawImageMesh(const RenderImage* image,
+                                       rcp<RenderBuffer> vertices_f32,
+                                       rcp<RenderBuffer> uvCoords_f32,
+                                       rcp<RenderBuffer> indices_u16,
+                                       uint32_t vertexCount,
+                                       uint32_t indexCount,
+                                       BlendMode blendMode,
+                                       float opacity)
+{
+    syncBackend();
+    m_counters.draws++;
+    m_backend->drawImageMesh(image,
+                             std::move(vertices_f32),
+                             std::move(uvCoords_f32),
+                             std::move(indices_u16),
+                             vertexCount,
+                             indexCount,
+                             blendMode,
+                             opacity);
+}
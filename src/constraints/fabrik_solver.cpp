@@ -0,0 +1,103 @@
+#include "rive/constraints/fabrik_solver.hpp"
+#include <cmath>
+
+using namespace rive;
+
+void FabrikSolver::resize(size_t jointCount)
+{
+    m_x.resize(jointCount);
+    m_y.resize(jointCount);
+    m_lengths.resize(jointCount == 0 ? 0 : jointCount - 1);
+}
+
+void FabrikSolver::measure()
+{
+    m_totalLength = 0.0f;
+    for (size_t i = 0, count = m_lengths.size(); i < count; i++)
+    {
+        float dx = m_x[i + 1] - m_x[i];
+        float dy = m_y[i + 1] - m_y[i];
+        m_lengths[i] = std::sqrt(dx * dx + dy * dy);
+        m_totalLength += m_lengths[i];
+    }
+}
+
+// Place joint `to` on the line from joint `from` towards its current
+// position, at length away from `from`.
+static void reach(float* x, float* y, size_t from, size_t to, float length)
+{
+    float dx = x[to] - x[from];
+    float dy = y[to] - y[from];
+    float distance = std::sqrt(dx * dx + dy * dy);
+    if (distance == 0.0f)
+    {
+        return;
+    }
+    float scale = length / distance;
+    x[to] = x[from] + dx * scale;
+    y[to] = y[from] + dy * scale;
+}
+
+int FabrikSolver::solve(Vec2D target, int maxIterations, float tolerance)
+{
+    size_t count = m_lengths.size();
+    if (count == 0)
+    {
+        return 0;
+    }
+    float* x = m_x.data();
+    float* y = m_y.data();
+    const float* lengths = m_lengths.data();
+
+    float rootX = x[0];
+    float rootY = y[0];
+    float toTargetX = target.x - rootX;
+    float toTargetY = target.y - rootY;
+    float targetDistance = std::sqrt(toTargetX * toTargetX + toTargetY * toTargetY);
+    if (targetDistance >= m_totalLength)
+    {
+        // Out of reach, straighten the chain towards the target.
+        if (targetDistance == 0.0f)
+        {
+            return 0;
+        }
+        float dirX = toTargetX / targetDistance;
+        float dirY = toTargetY / targetDistance;
+        for (size_t i = 0; i < count; i++)
+        {
+            x[i + 1] = x[i] + dirX * lengths[i];
+            y[i + 1] = y[i] + dirY * lengths[i];
+        }
+        return 1;
+    }
+
+    float toleranceSquared = tolerance * tolerance;
+    int iteration = 0;
+    while (iteration < maxIterations)
+    {
+        float errorX = x[count] - target.x;
+        float errorY = y[count] - target.y;
+        if (errorX * errorX + errorY * errorY <= toleranceSquared)
+        {
+            break;
+        }
+        iteration++;
+
+        // Backward pass: pin the tip to the target and work to the root.
+        x[count] = target.x;
+        y[count] = target.y;
+        for (size_t i = count; i > 0; i--)
+        {
+            reach(x, y, i, i - 1, lengths[i - 1]);
+        }
+
+        // Forward pass: pin the root back and work out to the tip.
+        x[0] = rootX;
+        y[0] = rootY;
+        for (size_t i = 0; i < count; i++)
+        {
+            reach(x, y, i, i + 1, lengths[i]);
+        }
+    }
+    return iteration;
+}
@@ -33,29 +33,33 @@ const Mat2D FollowPathConstraint::targetTransform() const
 {
     if (m_Target->is<Shape>() || m_Target->is<Path>())
     {
-        float totalLength = 0.0f;
-        for (auto contour : m_contours)
-        {
-            totalLength += contour->length();
-        }
-
         float actualDistance = positiveMod(distance(), 1.0f);
         if (distance() != 0 && actualDistance == 0)
         {
             actualDistance = 1;
         }
-        float distanceUnits = totalLength * std::min(1.0f, std::max(0.0f, actualDistance));
-        float runningLength = 0;
+        float distanceUnits = m_totalLength * std::min(1.0f, std::max(0.0f, actualDistance));
         ContourMeasure::PosTan posTan = ContourMeasure::PosTan();
-        for (auto contour : m_contours)
+        if (!m_contours.empty())
         {
-            float pathLength = contour->length();
-            if (distanceUnits <= pathLength + runningLength)
+            // Move the cursor back to the first contour if we went backwards,
+            // otherwise walk forward from where we last were.
+            if (m_contourCursor >= m_contours.size() || distanceUnits < m_contourCursorStart)
+            {
+                m_contourCursor = 0;
+                m_contourCursorStart = 0.0f;
+                m_segmentCursor = 0;
+            }
+            size_t lastContour = m_contours.size() - 1;
+            while (m_contourCursor < lastContour &&
+                   distanceUnits > m_contourCursorStart + m_contours[m_contourCursor]->length())
             {
-                posTan = contour->getPosTan(distanceUnits - runningLength);
-                break;
+                m_contourCursorStart += m_contours[m_contourCursor]->length();
+                m_contourCursor++;
+                m_segmentCursor = 0;
             }
-            runningLength += pathLength;
+            posTan = m_contours[m_contourCursor]->getPosTan(distanceUnits - m_contourCursorStart,
+                                                            &m_segmentCursor);
         }
         Vec2D position = Vec2D(posTan.pos.x, posTan.pos.y);
         Mat2D transformB = Mat2D(m_Target->worldTransform());
@@ -109,17 +113,22 @@ void FollowPathConstraint::constrain(TransformComponent* component)
         transformB = targetParentWorld * transformB;
     }
 
-    m_ComponentsA = transformA.decompose();
-    m_ComponentsB = transformB.decompose();
-
     float t = strength();
     float ti = 1.0f - t;
 
     if (!orient())
     {
-        float angleA = std::fmod(m_ComponentsA.rotation(), math::PI * 2);
-        m_ComponentsB.rotation(angleA);
+        // Rotation, scale and skew all come from the constrained component,
+        // so only the translation needs to be interpolated.
+        Mat2D& world = component->mutableWorldTransform();
+        world[4] = world[4] * ti + transformB[4] * t;
+        world[5] = world[5] * ti + transformB[5] * t;
+        return;
     }
+
+    m_ComponentsA = m_DecomposeA.decompose(transformA);
+    m_ComponentsB = transformB.decompose();
+
     m_ComponentsB.x(m_ComponentsA.x() * ti + m_ComponentsB.x() * t);
     m_ComponentsB.y(m_ComponentsA.y() * ti + m_ComponentsB.y() * t);
     m_ComponentsB.scaleX(m_ComponentsA.scaleX());
@@ -131,24 +140,40 @@ void FollowPathConstraint::constrain(TransformComponent* component)
 
 void FollowPathConstraint::update(ComponentDirt value)
 {
-    std::vector<Path*> paths;
+    // Only re-measure when the target's geometry or placement changed,
+    // animating distance alone reuses the measures.
+    if (hasDirt(value,
+                ComponentDirt::Path | ComponentDirt::Vertices | ComponentDirt::Transform |
+                    ComponentDirt::WorldTransform))
+    {
+        buildContours();
+    }
+}
+
+void FollowPathConstraint::buildContours()
+{
+    m_paths.clear();
     if (m_Target->is<Shape>())
     {
         auto shape = m_Target->as<Shape>();
         for (auto path : shape->paths())
         {
-            paths.push_back(path);
+            m_paths.push_back(path);
         }
     }
     else if (m_Target->is<Path>())
     {
-        paths.push_back(m_Target->as<Path>());
+        m_paths.push_back(m_Target->as<Path>());
     }
-    if (paths.size() > 0)
+    if (m_paths.size() > 0)
     {
         m_rawPath.rewind();
         m_contours.clear();
-        for (auto path : paths)
+        m_totalLength = 0.0f;
+        m_contourCursor = 0;
+        m_contourCursorStart = 0.0f;
+        m_segmentCursor = 0;
+        for (auto path : m_paths)
         {
             auto commandPath = static_cast<MetricsPath*>(path->commandPath());
             commandPath->addToRawPath(m_rawPath, path->pathTransform());
@@ -157,6 +182,7 @@ void FollowPathConstraint::update(ComponentDirt value)
         auto measure = ContourMeasureIter(&m_rawPath);
         for (auto contour = measure.next(); contour != nullptr; contour = measure.next())
         {
+            m_totalLength += contour->length();
             m_contours.push_back(contour);
         }
     }
@@ -51,6 +51,7 @@ StatusCode IKConstraint::onAddedClean(CoreContext* context)
         link.bone = *boneItr;
         link.angle = 0.0f;
     }
+    m_Fabrik.resize(numBones + 1);
 
     // Make sure all of the first level children of each bone depend on the
     // tip (constrainedComponent).
@@ -94,6 +95,23 @@ void IKConstraint::markConstraintDirty()
     }
 }
 
+void IKConstraint::solver(Solver value)
+{
+    if (m_Solver == value)
+    {
+        return;
+    }
+    m_Solver = value;
+    markConstraintDirty();
+}
+
+void IKConstraint::solverBudget(int maxIterations, float tolerance)
+{
+    m_SolverIterations = maxIterations;
+    m_SolverTolerance = tolerance;
+    markConstraintDirty();
+}
+
 void IKConstraint::solve1(BoneChainLink* fk1, const Vec2D& worldTargetTranslation)
 {
     Mat2D iworld = fk1->parentWorldInverse;
@@ -186,6 +204,42 @@ void IKConstraint::solve2(BoneChainLink* fk1,
     firstChild->angle = r2;
 }
 
+void IKConstraint::solveFabrik(const Vec2D& worldTargetTranslation)
+{
+    int count = (int)m_FkChain.size();
+    for (int i = 0; i < count; i++)
+    {
+        m_Fabrik.joint(i, m_FkChain[i].bone->worldTranslation());
+    }
+    m_Fabrik.joint(count, m_FkChain[count - 1].bone->tipWorldTranslation());
+    m_Fabrik.measure();
+    m_Fabrik.solve(worldTargetTranslation, m_SolverIterations, m_SolverTolerance);
+
+    // Convert the solved joint positions back to local rotations, top down so
+    // each bone sees its parent's new world transform.
+    for (int i = 0; i < count; i++)
+    {
+        BoneChainLink& fk = m_FkChain[i];
+        Bone* bone = fk.bone;
+        const Mat2D& parentWorld = getParentWorld(*bone);
+        Mat2D& world = bone->mutableWorldTransform();
+        world = parentWorld * bone->transform();
+
+        Vec2D origin = world.translation();
+        Vec2D end = i + 1 < count ? world * m_FkChain[i + 1].bone->transform().translation()
+                                  : bone->tipWorldTranslation();
+
+        Mat2D parentWorldInverse = parentWorld.invertOrIdentity();
+        float current = atan2(Vec2D::transformDir(end - origin, parentWorldInverse));
+        float desired = atan2(
+            Vec2D::transformDir(m_Fabrik.joint(i + 1) - m_Fabrik.joint(i), parentWorldInverse));
+
+        float rotation = fk.transformComponents.rotation() + desired - current;
+        constrainRotation(fk, rotation);
+        fk.angle = rotation;
+    }
+}
+
 void IKConstraint::constrainRotation(BoneChainLink& fk, float rotation)
 {
     Bone* bone = fk.bone;
@@ -245,10 +299,20 @@ void IKConstraint::constrain(TransformComponent* component)
             solve1(&m_FkChain[0], worldTargetTranslation);
             break;
         case 2:
+            if (m_Solver == Solver::kFabrik)
+            {
+                solveFabrik(worldTargetTranslation);
+                break;
+            }
             solve2(&m_FkChain[0], &m_FkChain[1], worldTargetTranslation);
             break;
         default:
         {
+            if (m_Solver == Solver::kFabrik)
+            {
+                solveFabrik(worldTargetTranslation);
+                break;
+            }
             auto last = count - 1;
             BoneChainLink* tip = &m_FkChain[last];
             for (int i = 0; i < last; i++)
@@ -13,7 +13,7 @@ void RotationConstraint::constrain(TransformComponent* component)
     }
     const Mat2D& transformA = component->worldTransform();
     Mat2D transformB;
-    m_ComponentsA = transformA.decompose();
+    m_ComponentsA = m_DecomposeA.decompose(transformA);
     if (m_Target == nullptr)
     {
         transformB = transformA;
@@ -33,7 +33,7 @@ void RotationConstraint::constrain(TransformComponent* component)
             transformB = inverse * transformB;
         }
 
-        m_ComponentsB = transformB.decompose();
+        m_ComponentsB = m_DecomposeB.decompose(transformB);
 
         if (!doesCopy())
         {
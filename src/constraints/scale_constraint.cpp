@@ -13,7 +13,7 @@ void ScaleConstraint::constrain(TransformComponent* component)
     }
     const Mat2D& transformA = component->worldTransform();
     Mat2D transformB;
-    m_ComponentsA = transformA.decompose();
+    m_ComponentsA = m_DecomposeA.decompose(transformA);
     if (m_Target == nullptr)
     {
         transformB = transformA;
@@ -31,7 +31,7 @@ void ScaleConstraint::constrain(TransformComponent* component)
             }
             transformB = inverse * transformB;
         }
-        m_ComponentsB = transformB.decompose();
+        m_ComponentsB = m_DecomposeB.decompose(transformB);
 
         if (!doesCopy())
         {
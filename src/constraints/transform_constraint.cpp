@@ -40,8 +40,20 @@ void TransformConstraint::constrain(TransformComponent* component)
         transformB = targetParentWorld * transformB;
     }
 
-    m_ComponentsA = transformA.decompose();
-    m_ComponentsB = transformB.decompose();
+    float t = strength();
+    if (t == 1.0f)
+    {
+        // Fully constrained, the result is the target transform.
+        component->mutableWorldTransform() = transformB;
+        return;
+    }
+    if (t == 0.0f)
+    {
+        return;
+    }
+
+    m_ComponentsA = m_DecomposeA.decompose(transformA);
+    m_ComponentsB = m_DecomposeB.decompose(transformB);
 
     float angleA = std::fmod(m_ComponentsA.rotation(), math::PI * 2);
     float angleB = std::fmod(m_ComponentsB.rotation(), math::PI * 2);
@@ -55,7 +67,6 @@ void TransformConstraint::constrain(TransformComponent* component)
         diff += math::PI * 2;
     }
 
-    float t = strength();
     float ti = 1.0f - t;
 
     m_ComponentsB.rotation(angleA + diff * t);
@@ -1,38 +1,67 @@
 #include "rive/dependency_sorter.hpp"
 #include "rive/component.hpp"
 
+#include <algorithm>
+#include <cstdio>
+
 using namespace rive;
 
-void DependencySorter::sort(Component* root, std::vector<Component*>& order)
+bool DependencySorter::findSlot(Component* component, uint32_t& slot) const
 {
-    order.clear();
-    visit(root, order);
+    // Slots are stamped onto components as they're discovered. A stale slot
+    // left over from a previous sort won't point back at the component.
+    slot = component->m_SortSlot;
+    return slot < m_Components.size() && m_Components[slot] == component;
 }
 
-bool DependencySorter::visit(Component* component, std::vector<Component*>& order)
+bool DependencySorter::sort(Component* root, std::vector<Component*>& order)
 {
-    if (m_Perm.find(component) != m_Perm.end())
-    {
-        return true;
-    }
-    if (m_Temp.find(component) != m_Temp.end())
-    {
-        fprintf(stderr, "Dependency cycle!\n");
-        return false;
-    }
+    order.clear();
+    m_Components.clear();
+    m_Marks.clear();
+    m_Stack.clear();
 
-    m_Temp.emplace(component);
+    root->m_SortSlot = 0;
+    m_Components.push_back(root);
+    m_Marks.push_back(Mark::Temporary);
+    m_Stack.push_back({root, 0});
 
-    auto dependents = component->dependents();
-    for (auto dependent : dependents)
+    bool acyclic = true;
+    while (!m_Stack.empty())
     {
-        if (!visit(dependent, order))
+        Frame& frame = m_Stack.back();
+        const std::vector<Component*>& dependents = frame.component->dependents();
+        if (frame.nextDependent == dependents.size())
+        {
+            uint32_t slot;
+            findSlot(frame.component, slot);
+            m_Marks[slot] = Mark::Permanent;
+            order.push_back(frame.component);
+            m_Stack.pop_back();
+            continue;
+        }
+
+        Component* dependent = dependents[frame.nextDependent++];
+        uint32_t slot;
+        if (findSlot(dependent, slot))
         {
-            return false;
+            if (m_Marks[slot] == Mark::Permanent)
+            {
+                continue;
+            }
+            fprintf(stderr, "Dependency cycle!\n");
+            acyclic = false;
+            break;
         }
+
+        dependent->m_SortSlot = (uint32_t)m_Components.size();
+        m_Components.push_back(dependent);
+        m_Marks.push_back(Mark::Temporary);
+        // Note that this may reallocate, invalidating frame.
+        m_Stack.push_back({dependent, 0});
     }
-    m_Perm.emplace(component);
-    order.insert(order.begin(), component);
 
-    return true;
-}
\ No newline at end of file
+    // Components were appended as they finished, dependents first.
+    std::reverse(order.begin(), order.end());
+    return acyclic;
+}
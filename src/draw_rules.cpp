@@ -26,13 +26,14 @@ StatusCode DrawRules::onAddedClean(CoreContext* context) { return StatusCode::Ok
 void DrawRules::drawTargetIdChanged()
 {
     auto coreObject = artboard()->resolve(drawTargetId());
-    if (coreObject == nullptr || !coreObject->is<DrawTarget>())
+    DrawTarget* target = coreObject == nullptr || !coreObject->is<DrawTarget>()
+                             ? nullptr
+                             : static_cast<DrawTarget*>(coreObject);
+    // Only re-sort when the effective target actually changed.
+    if (target == m_ActiveTarget)
     {
-        m_ActiveTarget = nullptr;
-    }
-    else
-    {
-        m_ActiveTarget = static_cast<DrawTarget*>(coreObject);
+        return;
     }
+    m_ActiveTarget = target;
     artboard()->addDirt(ComponentDirt::DrawOrder);
 }
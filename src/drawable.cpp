@@ -70,4 +70,23 @@ ClipResult Drawable::clip(Renderer* renderer) const
         }
     }
     return ClipResult::clip;
-}
\ No newline at end of file
+}
+
+bool Drawable::isOutside(const AABB& area)
+{
+    AABB bounds;
+    if (drawBounds(&bounds) && !bounds.intersects(area))
+    {
+        return true;
+    }
+    // Clipped content only shows up within each of its clipping shapes.
+    for (auto clippingShape : m_ClippingShapes)
+    {
+        if (clippingShape->isVisible() && clippingShape->worldBounds(&bounds) &&
+            !bounds.intersects(area))
+        {
+            return true;
+        }
+    }
+    return false;
+}
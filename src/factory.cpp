@@ -18,6 +18,11 @@ rcp<RenderPath> Factory::makeRenderPath(const AABB& r)
     return makeRenderPath(rawPath, FillRule::nonZero);
 }
 
+rcp<RenderImage> Factory::decodeScaledImage(Span<const uint8_t> span, uint32_t maxDimension)
+{
+    return decodeImage(span);
+}
+
 rcp<Font> Factory::decodeFont(Span<const uint8_t> span)
 {
 #ifdef WITH_RIVE_TEXT
@@ -144,7 +144,8 @@ File::~File()
 std::unique_ptr<File> File::import(Span<const uint8_t> bytes,
                                    Factory* factory,
                                    ImportResult* result,
-                                   FileAssetLoader* assetLoader)
+                                   FileAssetLoader* assetLoader,
+                                   ImageBudget* imageBudget)
 {
     BinaryReader reader(bytes);
     RuntimeHeader header;
@@ -173,7 +174,9 @@ std::unique_ptr<File> File::import(Span<const uint8_t> bytes,
     }
     auto file = rivestd::make_unique<File>(factory, assetLoader);
 
+    file->m_imageBudget = imageBudget;
     auto readResult = file->read(reader, header);
+    file->m_imageBudget = nullptr;
     if (result)
     {
         *result = readResult;
@@ -299,7 +302,8 @@ ImportResult File::read(BinaryReader& reader, const RuntimeHeader& header)
             case AudioAsset::typeKey:
                 stackObject = rivestd::make_unique<FileAssetImporter>(object->as<FileAsset>(),
                                                                       m_assetLoader,
-                                                                      m_factory);
+                                                                      m_factory,
+                                                                      m_imageBudget);
                 stackType = FileAsset::typeKey;
                 break;
         }
@@ -357,6 +361,14 @@ std::string File::artboardNameAt(size_t index) const
     return ab ? ab->name() : "";
 }
 
+void File::shareStaticNestedArtboards(bool value)
+{
+    for (auto artboard : m_artboards)
+    {
+        artboard->shareStaticNestedArtboards(value);
+    }
+}
+
 std::unique_ptr<ArtboardInstance> File::artboardDefault() const
 {
     auto ab = this->artboard();
@@ -377,6 +389,52 @@ std::unique_ptr<ArtboardInstance> File::artboardNamed(std::string name) const
 
 const std::vector<FileAsset*>& File::assets() const { return m_fileAssets; }
 
+size_t File::imageMemoryEstimate() const
+{
+    size_t bytes = 0;
+    for (auto asset : m_fileAssets)
+    {
+        if (asset->is<ImageAsset>())
+        {
+            bytes += asset->as<ImageAsset>()->imageHeader().decodedByteSize();
+        }
+    }
+    return bytes;
+}
+
+size_t File::decodedImageMemory() const
+{
+    size_t bytes = 0;
+    for (auto asset : m_fileAssets)
+    {
+        if (asset->is<ImageAsset>())
+        {
+            bytes += asset->as<ImageAsset>()->decodedMemory();
+        }
+    }
+    return bytes;
+}
+
+MemoryFootprint File::memoryFootprint() const
+{
+    MemoryFootprint footprint;
+    footprint.coreObjects += sizeof(File) + MemoryFootprint::capacityBytes(m_fileAssets) +
+                             MemoryFootprint::capacityBytes(m_artboards);
+    if (m_backboard != nullptr)
+    {
+        m_backboard->addMemoryFootprint(footprint);
+    }
+    for (auto artboard : m_artboards)
+    {
+        artboard->addMemoryFootprint(footprint);
+    }
+    for (auto asset : m_fileAssets)
+    {
+        asset->addMemoryFootprint(footprint);
+    }
+    return footprint;
+}
+
 #ifdef WITH_RIVE_TOOLS
 const std::vector<uint8_t> File::stripAssets(Span<const uint8_t> bytes,
                                              std::set<uint16_t> typeKeys,
@@ -1,6 +1,7 @@
 #include "rive/importers/file_asset_importer.hpp"
 #include "rive/assets/file_asset_contents.hpp"
 #include "rive/assets/file_asset.hpp"
+#include "rive/assets/image_asset.hpp"
 #include "rive/file_asset_loader.hpp"
 #include "rive/span.hpp"
 #include <cstdint>
@@ -9,8 +10,12 @@ using namespace rive;
 
 FileAssetImporter::FileAssetImporter(FileAsset* fileAsset,
                                      FileAssetLoader* assetLoader,
-                                     Factory* factory) :
-    m_FileAsset(fileAsset), m_FileAssetLoader(assetLoader), m_Factory(factory)
+                                     Factory* factory,
+                                     ImageBudget* imageBudget) :
+    m_FileAsset(fileAsset),
+    m_FileAssetLoader(assetLoader),
+    m_Factory(factory),
+    m_ImageBudget(imageBudget)
 {}
 
 // if file asset contents are found when importing a rive file, store those for when we resolve
@@ -29,18 +34,39 @@ StatusCode FileAssetImporter::resolve()
     {
         bytes = m_Content->bytes();
     }
+    m_FileAsset->m_embeddedSize = bytes.size();
+
+    ImageAsset* imageAsset =
+        m_FileAsset->is<ImageAsset>() ? m_FileAsset->as<ImageAsset>() : nullptr;
+    if (imageAsset != nullptr && bytes.size() > 0)
+    {
+        // Lets loaders (and the budget) see the image's size before deciding
+        // how to load it.
+        imageAsset->probe(bytes);
+    }
 
     // If we have a file asset loader, lets give it the opportunity to claim responsibility for
     // loading the asset
     if (m_FileAssetLoader != nullptr &&
         m_FileAssetLoader->loadContents(*m_FileAsset, bytes, m_Factory))
     {
+        if (imageAsset != nullptr && m_ImageBudget != nullptr)
+        {
+            m_ImageBudget->usedBytes += imageAsset->decodedMemory();
+        }
         return StatusCode::Ok;
     }
     // If we do not, but we have found in band contents, load those
     else if (bytes.size() > 0)
     {
-        m_FileAsset->decode(m_Content->bytes(), m_Factory);
+        if (imageAsset != nullptr && m_ImageBudget != nullptr)
+        {
+            imageAsset->decode(m_Content->bytes(), m_Factory, m_ImageBudget);
+        }
+        else
+        {
+            m_FileAsset->decode(m_Content->bytes(), m_Factory);
+        }
     }
 
     // Note that it's ok for an asset to not resolve (or to resolve async).
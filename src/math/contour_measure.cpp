@@ -47,6 +47,21 @@ size_t ContourMeasure::findSegment(float distance) const
     return iter - m_segments.begin();
 }
 
+size_t ContourMeasure::findSegment(float distance, size_t hint) const
+{
+    // We're looking for the first segment that ends at or after distance, try
+    // the hinted segment and the one after it before searching.
+    for (size_t i = hint; i < m_segments.size() && i <= hint + 1; i++)
+    {
+        if (m_segments[i].m_distance >= distance &&
+            (i == 0 || m_segments[i - 1].m_distance < distance))
+        {
+            return i;
+        }
+    }
+    return findSegment(distance);
+}
+
 static ContourMeasure::PosTan eval_quad(const Vec2D pts[], float t)
 {
     assert(t >= 0 && t <= 1);
@@ -170,7 +185,28 @@ ContourMeasure::PosTan ContourMeasure::getPosTan(float distance) const
         distance = 0;
     }
 
-    size_t i = this->findSegment(distance);
+    return evalSegment(this->findSegment(distance), distance);
+}
+
+ContourMeasure::PosTan ContourMeasure::getPosTan(float distance, size_t* segmentCursor) const
+{
+    if (distance > m_length)
+    {
+        distance = m_length;
+    }
+
+    if (distance < 0)
+    {
+        distance = 0;
+    }
+
+    size_t i = this->findSegment(distance, *segmentCursor);
+    *segmentCursor = i;
+    return evalSegment(i, distance);
+}
+
+ContourMeasure::PosTan ContourMeasure::evalSegment(size_t i, float distance) const
+{
     assert(i < m_segments.size());
     const auto seg = m_segments[i];
     const float currD = seg.m_distance;
@@ -0,0 +1,22 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "rive/memory_footprint.hpp"
+#include "rive/core.hpp"
+#include "rive/generated/core_registry.hpp"
+
+using namespace rive;
+
+size_t MemoryFootprint::objectSize(const Core* object)
+{
+    size_t size = CoreRegistry::objectSize(object->coreType());
+    // Types the registry doesn't make (e.g. ArtboardInstance) at least count
+    // as a Core.
+    return size == 0 ? sizeof(Core) : size;
+}
+
+void Core::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    footprint.coreObjects += MemoryFootprint::objectSize(this);
+}
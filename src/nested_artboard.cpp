@@ -6,6 +6,9 @@
 #include "rive/nested_animation.hpp"
 #include "rive/animation/nested_state_machine.hpp"
 #include "rive/clip_result.hpp"
+#include "rive/audio_event.hpp"
+#include "rive/text/text.hpp"
+#include "rive/memory_footprint.hpp"
 #include <cassert>
 
 using namespace rive;
@@ -20,11 +23,83 @@ Core* NestedArtboard::clone() const
     {
         return nestedArtboard;
     }
+    auto parent = Component::artboard();
+    if (parent != nullptr && parent->shareStaticNestedArtboards() && isStatic() &&
+        nestedArtboard->nestShared(m_Artboard))
+    {
+        return nestedArtboard;
+    }
     auto ni = m_Artboard->instance();
     nestedArtboard->nest(ni.release());
     return nestedArtboard;
 }
 
+bool NestedArtboard::isStatic() const
+{
+    if (!m_NestedAnimations.empty())
+    {
+        return false;
+    }
+    if (m_Artboard != nullptr)
+    {
+        for (auto object : m_Artboard->objects())
+        {
+            if (object == nullptr)
+            {
+                continue;
+            }
+            if (object->is<AudioEvent>() ||
+                (object->is<Text>() && object->as<Text>()->haveModifiers()))
+            {
+                return false;
+            }
+        }
+        for (auto nested : m_Artboard->nestedArtboards())
+        {
+            if (!nested->isStatic())
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool NestedArtboard::nestShared(Artboard* source)
+{
+    assert(source != nullptr && !source->isInstance());
+    auto shared = source->sharedInstance();
+    if (shared == nullptr)
+    {
+        return false;
+    }
+    // The shared instance is set up once by sharedInstance() and is read only
+    // from then on, nests never advance it or change its properties.
+    m_Instance = nullptr;
+    m_SharedInstance = std::move(shared);
+    m_SharedSource = source;
+    m_Artboard = m_SharedInstance.get();
+    return true;
+}
+
+void NestedArtboard::unshare()
+{
+    assert(m_SharedSource != nullptr);
+    auto instance = m_SharedSource->instance();
+    m_SharedInstance = nullptr;
+    m_SharedSource = nullptr;
+    m_Artboard = nullptr;
+    if (instance != nullptr)
+    {
+        nest(instance.release());
+        auto parent = Component::artboard();
+        if (parent != nullptr)
+        {
+            m_Artboard->volume(parent->volume());
+        }
+    }
+}
+
 void NestedArtboard::nest(Artboard* artboard)
 {
     assert(artboard != nullptr);
@@ -55,10 +130,11 @@ static Mat2D makeTranslate(const Artboard* artboard)
 
 void NestedArtboard::draw(Renderer* renderer)
 {
-    if (m_Artboard == nullptr)
+    if (m_Artboard == nullptr || !isInViewport())
     {
         return;
     }
+    updateViewport();
     ClipResult clipResult = clip(renderer);
     if (clipResult == ClipResult::noClip)
     {
@@ -115,7 +191,8 @@ StatusCode NestedArtboard::onAddedClean(CoreContext* context)
     // does require that we always use an artboard instance (not just the source
     // artboard) when working with nested artboards, but in general this is good
     // practice for any loaded Rive file.
-    assert(m_Artboard == nullptr || m_Artboard == m_Instance.get());
+    assert(m_Artboard == nullptr || m_Artboard == m_Instance.get() ||
+           m_Artboard == m_SharedInstance.get());
 
     if (m_Instance)
     {
@@ -127,13 +204,76 @@ StatusCode NestedArtboard::onAddedClean(CoreContext* context)
     return Super::onAddedClean(context);
 }
 
+bool NestedArtboard::isInViewport() const
+{
+    auto parent = Component::artboard();
+    if (m_Artboard == nullptr || parent == nullptr || !parent->hasViewport())
+    {
+        return true;
+    }
+    if (!m_Artboard->clip())
+    {
+        // Content can draw anywhere, don't guess.
+        return true;
+    }
+    AABB bounds = worldTransform().mapBoundingBox(m_Artboard->bounds());
+    return bounds.intersects(parent->viewport());
+}
+
+void NestedArtboard::updateViewport()
+{
+    // A shared instance is drawn by nests with different transforms so it
+    // can't hold any one of their viewports.
+    if (m_Instance == nullptr)
+    {
+        return;
+    }
+    auto parent = Component::artboard();
+    Mat2D inverse;
+    if (parent == nullptr || !parent->hasViewport() || !worldTransform().invert(&inverse))
+    {
+        m_Instance->clearViewport();
+        return;
+    }
+    m_Instance->viewport(inverse.mapBoundingBox(parent->viewport()));
+    m_Instance->offscreenNestedAdvance(parent->offscreenNestedAdvance(),
+                                       parent->offscreenThrottleSeconds());
+}
+
 bool NestedArtboard::advance(float elapsedSeconds)
 {
     bool keepGoing = false;
-    if (m_Artboard == nullptr || isCollapsed())
+    // Shared instances have nothing to animate and must not change.
+    if (m_Artboard == nullptr || isCollapsed() || m_SharedInstance != nullptr)
     {
         return keepGoing;
     }
+    updateViewport();
+    if (!isInViewport())
+    {
+        auto parent = Component::artboard();
+        switch (parent->offscreenNestedAdvance())
+        {
+            case Artboard::OffscreenAdvance::kAdvance:
+                break;
+            case Artboard::OffscreenAdvance::kThrottle:
+                m_OffscreenElapsedSeconds += elapsedSeconds;
+                if (m_OffscreenElapsedSeconds < parent->offscreenThrottleSeconds())
+                {
+                    // Still wants time, just not every frame.
+                    return true;
+                }
+                // Accumulated time (including this frame) gets applied below.
+                elapsedSeconds = 0.0f;
+                break;
+            case Artboard::OffscreenAdvance::kPause:
+                // Nothing to do until it's back in view, moving the viewport
+                // marks the host dirty so it gets advanced again.
+                return false;
+        }
+    }
+    elapsedSeconds += m_OffscreenElapsedSeconds;
+    m_OffscreenElapsedSeconds = 0.0f;
     for (auto animation : m_NestedAnimations)
     {
         keepGoing = animation->advance(elapsedSeconds) || keepGoing;
@@ -146,7 +286,16 @@ void NestedArtboard::update(ComponentDirt value)
     Super::update(value);
     if (hasDirt(value, ComponentDirt::RenderOpacity) && m_Artboard != nullptr)
     {
-        m_Artboard->opacity(renderOpacity());
+        if (m_SharedInstance == nullptr)
+        {
+            m_Artboard->opacity(renderOpacity());
+        }
+        else if (renderOpacity() != 1.0f)
+        {
+            // The shared instance is drawn fully opaque. The renderer can't
+            // modulate opacity, so fading needs an instance of our own.
+            unshare();
+        }
     }
 }
 
@@ -180,4 +329,16 @@ bool NestedArtboard::worldToLocal(Vec2D world, Vec2D* local)
     *local = toMountedArtboard * world;
 
     return true;
-}
\ No newline at end of file
+}
+
+void NestedArtboard::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    footprint.coreObjects += MemoryFootprint::capacityBytes(m_NestedAnimations);
+    // Shared instances belong to their source artboard, only count the one
+    // this nest owns.
+    if (m_Instance != nullptr)
+    {
+        m_Instance->addMemoryFootprint(footprint);
+    }
+}
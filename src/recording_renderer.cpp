@@ -0,0 +1,290 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "rive/recording_renderer.hpp"
+
+#include <new>
+
+using namespace rive;
+
+namespace
+{
+enum class Op : uint8_t
+{
+    save,
+    restore,
+    transform,
+    clipPath,
+    drawPath,
+    drawImage,
+    drawImageMesh,
+};
+
+// Every command starts with its header so the arena can be walked without
+// knowing the command's type up front.
+struct Header
+{
+    Op op;
+    uint32_t size;
+};
+
+struct TransformCommand
+{
+    Header header;
+    Mat2D transform;
+};
+
+struct PathCommand
+{
+    Header header;
+    RenderPath* path;
+    RenderPaint* paint; // Null for clipPath.
+};
+
+struct ImageCommand
+{
+    Header header;
+    const RenderImage* image;
+    BlendMode blendMode;
+    float opacity;
+};
+
+struct ImageMeshCommand
+{
+    Header header;
+    const RenderImage* image;
+    RenderBuffer* vertices;
+    RenderBuffer* uvCoords;
+    RenderBuffer* indices;
+    uint32_t vertexCount;
+    uint32_t indexCount;
+    BlendMode blendMode;
+    float opacity;
+};
+
+constexpr size_t kBlockSize = 16 * 1024;
+constexpr size_t kAlignment = alignof(void*) > alignof(Mat2D) ? alignof(void*) : alignof(Mat2D);
+
+constexpr size_t alignedSize(size_t size) { return (size + kAlignment - 1) & ~(kAlignment - 1); }
+
+// Visits every command in the blocks up to and including lastBlock.
+template <typename Block, typename Visitor>
+void forEachCommand(const std::vector<Block>& blocks, size_t lastBlock, Visitor visit)
+{
+    for (size_t i = 0; i < blocks.size() && i <= lastBlock; i++)
+    {
+        const Block& block = blocks[i];
+        for (size_t offset = 0; offset < block.used;)
+        {
+            auto header = reinterpret_cast<Header*>(block.bytes.get() + offset);
+            visit(header);
+            offset += header->size;
+        }
+    }
+}
+} // namespace
+
+RecordingRenderer::RecordingRenderer() {}
+
+RecordingRenderer::~RecordingRenderer() { clear(); }
+
+RecordingRenderer::RecordingRenderer(RecordingRenderer&& other) :
+    m_blocks(std::move(other.m_blocks)),
+    m_currentBlock(other.m_currentBlock),
+    m_commandCount(other.m_commandCount)
+{
+    other.m_blocks.clear();
+    other.m_currentBlock = 0;
+    other.m_commandCount = 0;
+}
+
+RecordingRenderer& RecordingRenderer::operator=(RecordingRenderer&& other)
+{
+    if (this != &other)
+    {
+        clear();
+        std::swap(m_blocks, other.m_blocks);
+        std::swap(m_currentBlock, other.m_currentBlock);
+        std::swap(m_commandCount, other.m_commandCount);
+    }
+    return *this;
+}
+
+template <typename T> T* RecordingRenderer::allocate()
+{
+    constexpr size_t size = alignedSize(sizeof(T));
+    static_assert(size <= kBlockSize, "command doesn't fit in a block");
+    if (m_blocks.empty())
+    {
+        m_blocks.push_back({std::unique_ptr<uint8_t[]>(new uint8_t[kBlockSize]), kBlockSize, 0});
+        m_currentBlock = 0;
+    }
+    if (m_blocks[m_currentBlock].capacity - m_blocks[m_currentBlock].used < size)
+    {
+        // Move on to the next block, blocks kept from a previous recording are
+        // already empty.
+        m_currentBlock++;
+        if (m_currentBlock == m_blocks.size())
+        {
+            m_blocks.push_back(
+                {std::unique_ptr<uint8_t[]>(new uint8_t[kBlockSize]), kBlockSize, 0});
+        }
+    }
+    Block& block = m_blocks[m_currentBlock];
+    auto command = new (block.bytes.get() + block.used) T();
+    reinterpret_cast<Header*>(command)->size = size;
+    block.used += size;
+    m_commandCount++;
+    return command;
+}
+
+void RecordingRenderer::clear()
+{
+    forEachCommand(m_blocks, m_currentBlock, [](Header* header) {
+        switch (header->op)
+        {
+            case Op::clipPath:
+            case Op::drawPath:
+            {
+                auto command = reinterpret_cast<PathCommand*>(header);
+                safe_unref(command->path);
+                safe_unref(command->paint);
+                break;
+            }
+            case Op::drawImage:
+                safe_unref(reinterpret_cast<ImageCommand*>(header)->image);
+                break;
+            case Op::drawImageMesh:
+            {
+                auto command = reinterpret_cast<ImageMeshCommand*>(header);
+                safe_unref(command->image);
+                safe_unref(command->vertices);
+                safe_unref(command->uvCoords);
+                safe_unref(command->indices);
+                break;
+            }
+            default:
+                break;
+        }
+    });
+    for (Block& block : m_blocks)
+    {
+        block.used = 0;
+    }
+    m_currentBlock = 0;
+    m_commandCount = 0;
+}
+
+size_t RecordingRenderer::byteSize() const
+{
+    size_t size = 0;
+    for (const Block& block : m_blocks)
+    {
+        size += block.used;
+    }
+    return size;
+}
+
+void RecordingRenderer::replay(Renderer* renderer) const
+{
+    forEachCommand(m_blocks, m_currentBlock, [renderer](Header* header) {
+        switch (header->op)
+        {
+            case Op::save:
+                renderer->save();
+                break;
+            case Op::restore:
+                renderer->restore();
+                break;
+            case Op::transform:
+                renderer->transform(reinterpret_cast<TransformCommand*>(header)->transform);
+                break;
+            case Op::clipPath:
+                renderer->clipPath(reinterpret_cast<PathCommand*>(header)->path);
+                break;
+            case Op::drawPath:
+            {
+                auto command = reinterpret_cast<PathCommand*>(header);
+                renderer->drawPath(command->path, command->paint);
+                break;
+            }
+            case Op::drawImage:
+            {
+                auto command = reinterpret_cast<ImageCommand*>(header);
+                renderer->drawImage(command->image, command->blendMode, command->opacity);
+                break;
+            }
+            case Op::drawImageMesh:
+            {
+                auto command = reinterpret_cast<ImageMeshCommand*>(header);
+                renderer->drawImageMesh(command->image,
+                                        ref_rcp(command->vertices),
+                                        ref_rcp(command->uvCoords),
+                                        ref_rcp(command->indices),
+                                        command->vertexCount,
+                                        command->indexCount,
+                                        command->blendMode,
+                                        command->opacity);
+                break;
+            }
+        }
+    });
+}
+
+void RecordingRenderer::save() { allocate<Header>()->op = Op::save; }
+
+void RecordingRenderer::restore() { allocate<Header>()->op = Op::restore; }
+
+void RecordingRenderer::transform(const Mat2D& transform)
+{
+    auto command = allocate<TransformCommand>();
+    command->header.op = Op::transform;
+    command->transform = transform;
+}
+
+void RecordingRenderer::drawPath(RenderPath* path, RenderPaint* paint)
+{
+    auto command = allocate<PathCommand>();
+    command->header.op = Op::drawPath;
+    command->path = safe_ref(path);
+    command->paint = safe_ref(paint);
+}
+
+void RecordingRenderer::clipPath(RenderPath* path)
+{
+    auto command = allocate<PathCommand>();
+    command->header.op = Op::clipPath;
+    command->path = safe_ref(path);
+    command->paint = nullptr;
+}
+
+void RecordingRenderer::drawImage(const RenderImage* image, BlendMode blendMode, float opacity)
+{
+    auto command = allocate<ImageCommand>();
+    command->header.op = Op::drawImage;
+    command->image = safe_ref(image);
+    command->blendMode = blendMode;
+    command->opacity = opacity;
+}
+
+void RecordingRenderer::drawImageMesh(const RenderImage* image,
+                                      rcp<RenderBuffer> vertices_f32,
+                                      rcp<RenderBuffer> uvCoords_f32,
+                                      rcp<RenderBuffer> indices_u16,
+                                      uint32_t vertexCount,
+                                      uint32_t indexCount,
+                                      BlendMode blendMode,
+                                      float opacity)
+{
+    auto command = allocate<ImageMeshCommand>();
+    command->header.op = Op::drawImageMesh;
+    command->image = safe_ref(image);
+    command->vertices = vertices_f32.release();
+    command->uvCoords = uvCoords_f32.release();
+    command->indices = indices_u16.release();
+    command->vertexCount = vertexCount;
+    command->indexCount = indexCount;
+    command->blendMode = blendMode;
+    command->opacity = opacity;
+}
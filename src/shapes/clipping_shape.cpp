@@ -56,6 +56,7 @@ StatusCode ClippingShape::onAddedClean(CoreContext* context)
         }
     }
     m_RenderPath = artboard->factory()->makeEmptyRenderPath();
+    artboard->stats().renderPathsCreated++;
 
     return StatusCode::Ok;
 }
@@ -105,3 +106,26 @@ void ClippingShape::update(ComponentDirt value)
         }
     }
 }
+
+bool ClippingShape::worldBounds(AABB* bounds) const
+{
+    bool hasBounds = false;
+    for (auto shape : m_Shapes)
+    {
+        if (shape->isEmpty())
+        {
+            continue;
+        }
+        AABB shapeBounds = shape->worldBounds();
+        if (hasBounds)
+        {
+            bounds->expand(shapeBounds);
+        }
+        else
+        {
+            *bounds = shapeBounds;
+            hasBounds = true;
+        }
+    }
+    return hasBounds;
+}
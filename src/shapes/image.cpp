@@ -53,6 +53,22 @@ void Image::draw(Renderer* renderer)
     renderer->restore();
 }
 
+bool Image::drawBounds(AABB* bounds)
+{
+    // Meshes can be deformed anywhere.
+    rive::ImageAsset* asset = imageAsset();
+    if (asset == nullptr || asset->renderImage() == nullptr || m_Mesh != nullptr)
+    {
+        return false;
+    }
+    auto renderImage = asset->renderImage();
+    float width = (float)renderImage->width();
+    float height = (float)renderImage->height();
+    *bounds = worldTransform().mapBoundingBox(
+        AABB::fromLTWH(-width * originX(), -height * originY(), width, height));
+    return true;
+}
+
 Core* Image::hitTest(HitInfo* hinfo, const Mat2D& xform)
 {
     // TODO: handle clip?
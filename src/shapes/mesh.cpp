@@ -7,6 +7,7 @@
 #include "rive/factory.hpp"
 #include "rive/span.hpp"
 #include "rive/assets/image_asset.hpp"
+#include "rive/memory_footprint.hpp"
 #include <limits>
 
 using namespace rive;
@@ -60,6 +61,14 @@ StatusCode Mesh::onAddedClean(CoreContext* context)
             return StatusCode::InvalidObject;
         }
     }
+    if (artboard()->isInstance())
+    {
+        // The vertex buffer clone() made. Counted here, once the vertices are
+        // known, as clone() runs against the source artboard.
+        artboard()->stats().renderBuffersCreated++;
+        artboard()->stats().renderBufferBytes += m_Vertices.size() * sizeof(Vec2D);
+    }
+
     return Super::onAddedClean(context);
 }
 
@@ -125,6 +134,10 @@ void Mesh::initializeSharedBuffers(RenderImage* renderImage)
     m_IndexRenderBuffer = factory->makeRenderBuffer(RenderBufferType::index,
                                                     RenderBufferFlags::mappedOnceAtInitialization,
                                                     m_IndexBuffer->size() * sizeof(uint16_t));
+    RuntimeStats& stats = artboard()->stats();
+    stats.renderBuffersCreated += 3;
+    stats.renderBufferBytes +=
+        m_Vertices.size() * sizeof(Vec2D) * 2 + m_IndexBuffer->size() * sizeof(uint16_t);
     if (m_IndexRenderBuffer)
     {
         void* indexData = m_IndexRenderBuffer->map();
@@ -182,3 +195,30 @@ void Mesh::draw(Renderer* renderer, const RenderImage* image, BlendMode blendMod
                             blendMode,
                             opacity);
 }
+
+void Mesh::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    footprint.vertexData += MemoryFootprint::capacityBytes(m_Vertices);
+    if (m_VertexRenderBuffer != nullptr)
+    {
+        footprint.vertexData += m_VertexRenderBuffer->sizeInBytes();
+    }
+    // Instances share their source's indices and uvs.
+    if (artboard() != nullptr && artboard()->isInstance())
+    {
+        return;
+    }
+    if (m_IndexBuffer != nullptr)
+    {
+        footprint.vertexData += sizeof(IndexBuffer) + MemoryFootprint::capacityBytes(*m_IndexBuffer);
+    }
+    if (m_IndexRenderBuffer != nullptr)
+    {
+        footprint.vertexData += m_IndexRenderBuffer->sizeInBytes();
+    }
+    if (m_UVRenderBuffer != nullptr)
+    {
+        footprint.vertexData += m_UVRenderBuffer->sizeInBytes();
+    }
+}
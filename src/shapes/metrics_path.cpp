@@ -34,6 +34,16 @@ void MetricsPath::addPath(CommandPath* path, const Mat2D& transform)
     m_Paths.emplace_back(metricsPathCopy);
 }
 
+size_t MetricsPath::byteSize() const
+{
+    size_t size = m_RawPath.byteSize() + m_Paths.capacity() * sizeof(MetricsPath*);
+    for (auto path : m_Paths)
+    {
+        size += sizeof(OnlyMetricsPath) + path->byteSize();
+    }
+    return size;
+}
+
 RawPath::Iter MetricsPath::addToRawPath(RawPath& rawPath, const Mat2D& transform) const
 {
     return rawPath.addPath(m_RawPath, &transform);
@@ -98,6 +108,11 @@ void RenderMetricsPath::addPath(CommandPath* path, const Mat2D& transform)
     m_RenderPath->addPath(path->renderPath(), transform);
 }
 
+size_t RenderMetricsPath::byteSize() const
+{
+    return MetricsPath::byteSize() + m_RenderPath->byteSize();
+}
+
 void RenderMetricsPath::rewind()
 {
     MetricsPath::rewind();
@@ -139,6 +139,7 @@ void LinearGradient::makeGradient(RenderPaint* renderPaint,
     auto factory = artboard()->factory();
     renderPaint->shader(
         factory->makeLinearGradient(start.x, start.y, end.x, end.y, colors, stops, count));
+    artboard()->stats().shadersCreated++;
 }
 
 void LinearGradient::markGradientDirty() { addDirt(ComponentDirt::Paint); }
@@ -18,4 +18,5 @@ void RadialGradient::makeGradient(RenderPaint* renderPaint,
                                                     colors,
                                                     stops,
                                                     count));
+    artboard()->stats().shadersCreated++;
 }
@@ -22,8 +22,9 @@ RenderPaint* ShapePaint::initRenderPaint(ShapePaintMutator* mutator)
     assert(m_RenderPaint == nullptr);
     m_PaintMutator = mutator;
 
-    auto factory = mutator->component()->artboard()->factory();
-    m_RenderPaint = factory->makeRenderPaint();
+    auto artboard = mutator->component()->artboard();
+    m_RenderPaint = artboard->factory()->makeRenderPaint();
+    artboard->stats().renderPaintsCreated++;
     return m_RenderPaint.get();
 }
 
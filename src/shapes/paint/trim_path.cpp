@@ -1,7 +1,9 @@
 #include "rive/shapes/paint/trim_path.hpp"
+#include "rive/artboard.hpp"
 #include "rive/shapes/metrics_path.hpp"
 #include "rive/shapes/paint/stroke.hpp"
 #include "rive/factory.hpp"
+#include "rive/memory_footprint.hpp"
 
 using namespace rive;
 
@@ -32,6 +34,7 @@ RenderPath* TrimPath::effectPath(MetricsPath* source, Factory* factory)
     if (!m_TrimmedPath)
     {
         m_TrimmedPath = factory->makeEmptyRenderPath();
+        artboard()->stats().renderPathsCreated++;
     }
     else
     {
@@ -130,3 +133,12 @@ void TrimPath::startChanged() { invalidateEffect(); }
 void TrimPath::endChanged() { invalidateEffect(); }
 void TrimPath::offsetChanged() { invalidateEffect(); }
 void TrimPath::modeValueChanged() { invalidateEffect(); }
+
+void TrimPath::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    if (m_TrimmedPath != nullptr)
+    {
+        footprint.renderPaths += m_TrimmedPath->byteSize();
+    }
+}
@@ -1,4 +1,5 @@
 #include "rive/shapes/path.hpp"
+#include "rive/artboard.hpp"
 #include "rive/renderer.hpp"
 #include "rive/shapes/cubic_vertex.hpp"
 #include "rive/shapes/cubic_detached_vertex.hpp"
@@ -6,6 +7,7 @@
 #include "rive/shapes/shape.hpp"
 #include "rive/shapes/straight_vertex.hpp"
 #include "rive/math/math_types.hpp"
+#include "rive/memory_footprint.hpp"
 #include <cassert>
 
 using namespace rive;
@@ -262,6 +264,7 @@ void Path::update(ComponentDirt value)
         // tester).
         m_CommandPath->rewind();
         buildPath(*m_CommandPath);
+        artboard()->stats().pathsRebuilt++;
     }
     // if (hasDirt(value, ComponentDirt::WorldTransform) && m_Shape != nullptr)
     // {
@@ -434,3 +437,13 @@ FlattenedPath::~FlattenedPath()
 }
 
 #endif
+
+void Path::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    footprint.vertexData += MemoryFootprint::capacityBytes(m_Vertices);
+    if (m_CommandPath != nullptr)
+    {
+        footprint.renderPaths += m_CommandPath->byteSize();
+    }
+}
@@ -3,6 +3,7 @@
 #include "rive/renderer.hpp"
 #include "rive/shapes/path.hpp"
 #include "rive/shapes/shape.hpp"
+#include "rive/trace.hpp"
 
 using namespace rive;
 
@@ -39,6 +40,7 @@ void PathComposer::update(ComponentDirt value)
             return;
         }
         m_deferredPathDirt = false;
+        RIVE_TRACE_SCOPE_OBJECT("PathComposer::update", m_Shape->name());
 
         auto space = m_Shape->pathSpace();
         bool hasConstraint = (space & PathSpace::FollowPath) == PathSpace::FollowPath;
@@ -6,9 +6,11 @@
 #include "rive/shapes/clipping_shape.hpp"
 #include "rive/shapes/paint/blend_mode.hpp"
 #include "rive/shapes/paint/shape_paint.hpp"
+#include "rive/shapes/paint/stroke.hpp"
 #include "rive/shapes/path_composer.hpp"
 #include "rive/clip_result.hpp"
 #include "rive/math/raw_path.hpp"
+#include "rive/memory_footprint.hpp"
 #include <algorithm>
 
 using namespace rive;
@@ -311,4 +313,43 @@ AABB Shape::computeLocalBounds() const
     const Mat2D& world = worldTransform();
     Mat2D inverseWorld = world.invertOrIdentity();
     return computeWorldBounds(&inverseWorld);
-}
\ No newline at end of file
+}
+
+bool Shape::drawBounds(AABB* bounds)
+{
+    AABB world = worldBounds();
+    float outset = 0.0f;
+    for (auto shapePaint : m_ShapePaints)
+    {
+        if (!shapePaint->isVisible() || !shapePaint->is<Stroke>())
+        {
+            continue;
+        }
+        float thickness = shapePaint->as<Stroke>()->thickness();
+        if ((shapePaint->pathSpace() & PathSpace::Local) == PathSpace::Local)
+        {
+            thickness *= worldTransform().findMaxScale();
+        }
+        outset = std::max(outset, thickness);
+    }
+    // Strokes reach half their thickness past the path, up to the miter limit
+    // (4) times that at sharp joins.
+    outset *= 2.0f;
+    *bounds =
+        AABB(world.minX - outset, world.minY - outset, world.maxX + outset, world.maxY + outset);
+    return true;
+}
+
+void Shape::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    footprint.coreObjects += MemoryFootprint::capacityBytes(m_Paths);
+    if (m_PathComposer.localPath() != nullptr)
+    {
+        footprint.renderPaths += m_PathComposer.localPath()->byteSize();
+    }
+    if (m_PathComposer.worldPath() != nullptr)
+    {
+        footprint.renderPaths += m_PathComposer.worldPath()->byteSize();
+    }
+}
@@ -75,12 +75,15 @@ rcp<CommandPath> ShapePaintContainer::makeCommandPath(PathSpace space)
     }
 
     auto factory = getArtboard()->factory();
+    RuntimeStats& stats = getArtboard()->stats();
     if (needForEffects && needForRender)
     {
+        stats.renderPathsCreated++;
         return make_rcp<RenderMetricsPath>(factory->makeEmptyRenderPath());
     }
     else if (needForConstraint)
     {
+        stats.renderPathsCreated++;
         return make_rcp<RenderMetricsPath>(factory->makeEmptyRenderPath());
     }
     else if (needForEffects)
@@ -89,6 +92,7 @@ rcp<CommandPath> ShapePaintContainer::makeCommandPath(PathSpace space)
     }
     else
     {
+        stats.renderPathsCreated++;
         return factory->makeEmptyRenderPath();
     }
 }
@@ -1,4 +1,5 @@
 #include "rive/shapes/vertex.hpp"
+#include "rive/memory_footprint.hpp"
 
 using namespace rive;
 
@@ -21,4 +22,9 @@ void Vertex::deform(const Mat2D& worldTransform, const float* boneTransforms)
                                              m_Weight->values(),
                                              worldTransform,
                                              boneTransforms);
-}
\ No newline at end of file
+}
+
+void Vertex::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    footprint.vertexData += MemoryFootprint::objectSize(this);
+}
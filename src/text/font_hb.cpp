@@ -609,4 +609,13 @@ bool HBFont::hasGlyph(rive::Span<const rive::Unichar> missing) const
     return !missing.empty() && hb_font_get_nominal_glyph(m_font, missing[0], &glyph);
 }
 
+size_t HBFont::byteSize() const
+{
+    // Decode duplicates the font's bytes into the face's blob.
+    auto blob = hb_face_reference_blob(hb_font_get_face(m_font));
+    size_t size = hb_blob_get_length(blob);
+    hb_blob_destroy(blob);
+    return size;
+}
+
 #endif
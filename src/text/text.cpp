@@ -11,6 +11,8 @@ using namespace rive;
 #include "rive/artboard.hpp"
 #include "rive/factory.hpp"
 #include "rive/clip_result.hpp"
+#include "rive/trace.hpp"
+#include "rive/memory_footprint.hpp"
 
 void GlyphItr::tryAdvanceRun()
 {
@@ -327,6 +329,7 @@ void Text::buildRenderStyles()
         if (m_clipRenderPath == nullptr)
         {
             m_clipRenderPath = artboard()->factory()->makeEmptyRenderPath();
+            artboard()->stats().renderPathsCreated++;
         }
         else
         {
@@ -662,6 +665,7 @@ void Text::update(ComponentDirt value)
 
     if (hasDirt(value, ComponentDirt::Path))
     {
+        RIVE_TRACE_SCOPE_OBJECT("Text::update", name());
         // We have modifiers that need shaping we'll need to compute the coverage
         // right before we build the actual shape.
         bool precomputeModifierCoverage = modifierRangesNeedShape();
@@ -670,6 +674,7 @@ void Text::update(ComponentDirt value)
             makeStyled(m_modifierStyledText, false);
             auto runs = m_modifierStyledText.runs();
             m_modifierShape = runs[0].font->shapeText(m_modifierStyledText.unichars(), runs);
+            artboard()->stats().textShapes++;
             m_modifierLines = breakLines(m_modifierShape,
                                          sizing() == TextSizing::autoWidth ? -1.0f : width(),
                                          (TextAlign)alignValue());
@@ -688,6 +693,7 @@ void Text::update(ComponentDirt value)
         {
             auto runs = m_styledText.runs();
             m_shape = runs[0].font->shapeText(m_styledText.unichars(), runs);
+            artboard()->stats().textShapes++;
             m_lines = breakLines(m_shape,
                                  sizing() == TextSizing::autoWidth ? -1.0f : width(),
                                  (TextAlign)alignValue());
@@ -769,6 +775,68 @@ void Text::originYChanged()
     markWorldTransformDirty();
 }
 
+size_t Text::glyphCount() const
+{
+    size_t count = 0;
+    for (const Paragraph& paragraph : m_shape)
+    {
+        for (const GlyphRun& run : paragraph.runs)
+        {
+            count += run.glyphs.size();
+        }
+    }
+    return count;
+}
+
+static size_t shapeByteSize(const SimpleArray<Paragraph>& shape)
+{
+    size_t size = shape.size() * sizeof(Paragraph);
+    for (const Paragraph& paragraph : shape)
+    {
+        size += paragraph.runs.size() * sizeof(GlyphRun);
+        for (const GlyphRun& run : paragraph.runs)
+        {
+            size += run.glyphs.size() * sizeof(GlyphID) +
+                    run.textIndices.size() * sizeof(uint32_t) +
+                    run.advances.size() * sizeof(float) + run.xpos.size() * sizeof(float) +
+                    run.offsets.size() * sizeof(Vec2D) + run.breaks.size() * sizeof(uint32_t);
+        }
+    }
+    return size;
+}
+
+static size_t linesByteSize(const SimpleArray<SimpleArray<GlyphLine>>& lines)
+{
+    size_t size = lines.size() * sizeof(SimpleArray<GlyphLine>);
+    for (const SimpleArray<GlyphLine>& paragraphLines : lines)
+    {
+        size += paragraphLines.size() * sizeof(GlyphLine);
+    }
+    return size;
+}
+
+void Text::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    footprint.coreObjects += MemoryFootprint::capacityBytes(m_runs) +
+                             MemoryFootprint::capacityBytes(m_renderStyles) +
+                             MemoryFootprint::capacityBytes(m_modifierGroups);
+    footprint.textShaping += shapeByteSize(m_shape) + shapeByteSize(m_modifierShape) +
+                             linesByteSize(m_lines) + linesByteSize(m_modifierLines) +
+                             m_styledText.byteSize() + m_modifierStyledText.byteSize() +
+                             m_glyphLookup.byteSize();
+    for (const OrderedLine& line : m_orderedLines)
+    {
+        footprint.textShaping += line.byteSize();
+    }
+    footprint.textShaping +=
+        (m_orderedLines.capacity() - m_orderedLines.size()) * sizeof(OrderedLine);
+    if (m_clipRenderPath != nullptr)
+    {
+        footprint.renderPaths += m_clipRenderPath->byteSize();
+    }
+}
+
 #else
 // Text disabled.
 void Text::draw(Renderer* renderer) {}
@@ -791,4 +859,9 @@ AABB Text::localBounds() const { return AABB(); }
 void Text::originValueChanged() {}
 void Text::originXChanged() {}
 void Text::originYChanged() {}
+size_t Text::glyphCount() const { return 0; }
+void Text::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+}
 #endif
\ No newline at end of file
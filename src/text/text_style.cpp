@@ -8,6 +8,7 @@
 #include "rive/text/text.hpp"
 #include "rive/artboard.hpp"
 #include "rive/factory.hpp"
+#include "rive/memory_footprint.hpp"
 
 using namespace rive;
 
@@ -127,6 +128,7 @@ void TextStyle::buildDependencies()
     Super::buildDependencies();
     auto factory = getArtboard()->factory();
     m_path = factory->makeEmptyRenderPath();
+    getArtboard()->stats().renderPathsCreated++;
 }
 
 void TextStyle::rewindPath()
@@ -156,6 +158,7 @@ bool TextStyle::addPath(const RawPath& rawPath, float opacity)
         {
             auto factory = getArtboard()->factory();
             auto erp = factory->makeEmptyRenderPath();
+            getArtboard()->stats().renderPathsCreated++;
             renderPath = erp.get();
             m_opacityPaths[opacity] = std::move(erp);
         }
@@ -168,6 +171,9 @@ bool TextStyle::addPath(const RawPath& rawPath, float opacity)
 void TextStyle::draw(Renderer* renderer)
 {
     auto path = m_path.get();
+    // Each shape paint gets its own range of the pool so a renderer that
+    // holds on to the paints (like a recording) sees every one's state.
+    uint32_t paintIndex = 0;
     for (auto shapePaint : m_ShapePaints)
     {
         if (!shapePaint->isVisible())
@@ -176,17 +182,18 @@ void TextStyle::draw(Renderer* renderer)
         }
         shapePaint->draw(renderer, path);
 
-        if (m_paintPool.size() < m_opacityPaths.size())
+        size_t paintCount = paintIndex + m_opacityPaths.size();
+        if (m_paintPool.size() < paintCount)
         {
-            m_paintPool.reserve(m_opacityPaths.size());
+            m_paintPool.reserve(paintCount);
             Factory* factory = artboard()->factory();
-            while (m_paintPool.size() < m_opacityPaths.size())
+            while (m_paintPool.size() < paintCount)
             {
                 m_paintPool.emplace_back(factory->makeRenderPaint());
+                artboard()->stats().renderPaintsCreated++;
             }
         }
 
-        uint32_t paintIndex = 0;
         for (auto itr = m_opacityPaths.begin(); itr != m_opacityPaths.end(); itr++)
         {
             RenderPaint* renderPaint = m_paintPool[paintIndex++].get();
@@ -231,4 +238,22 @@ Core* TextStyle::clone() const
     }
 
     return twin;
-}
\ No newline at end of file
+}
+
+void TextStyle::addMemoryFootprint(MemoryFootprint& footprint) const
+{
+    Super::addMemoryFootprint(footprint);
+    footprint.coreObjects += MemoryFootprint::capacityBytes(m_coords) +
+                             MemoryFootprint::capacityBytes(m_variations) +
+                             MemoryFootprint::capacityBytes(m_paintPool) +
+                             MemoryFootprint::capacityBytes(m_styleFeatures) +
+                             MemoryFootprint::capacityBytes(m_features);
+    if (m_path != nullptr)
+    {
+        footprint.renderPaths += m_path->byteSize();
+    }
+    for (const auto& itr : m_opacityPaths)
+    {
+        footprint.renderPaths += itr.second->byteSize();
+    }
+}
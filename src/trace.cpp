@@ -0,0 +1,289 @@
+/*
+ * Copyright 2024 Rive
+ */
+
+#include "rive/trace.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+using namespace rive;
+
+namespace
+{
+// Written only by the thread that owns it. The collector reads the events
+// below written, dropping any the owner may have overwritten meanwhile.
+struct ThreadBuffer
+{
+    uint32_t threadId = 0;
+    // Set when the owning thread exits, Trace::release() then frees the
+    // buffer.
+    std::atomic<bool> exited{false};
+    // Capture the events belong to, the owner resets the buffer on its first
+    // event of a new capture.
+    std::atomic<uint32_t> generation{0};
+    std::atomic<uint64_t> written{0};
+    std::vector<TraceEvent> events;
+};
+
+// Registration is the only locked operation, it happens once per thread.
+struct Registry
+{
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    uint32_t nextThreadId = 0;
+};
+
+Registry& registry()
+{
+    static Registry registry;
+    return registry;
+}
+
+std::atomic<uint32_t> s_generation{0};
+std::atomic<size_t> s_eventsPerThread{1 << 16};
+std::atomic<int64_t> s_startNs{0};
+
+// Marks the thread's buffer as exited when the thread ends. The buffer itself
+// outlives the thread so its events can still be collected.
+struct ThreadBufferOwner
+{
+    ThreadBuffer* buffer = nullptr;
+    ~ThreadBufferOwner()
+    {
+        if (buffer != nullptr)
+        {
+            buffer->exited.store(true, std::memory_order_release);
+        }
+    }
+};
+thread_local ThreadBufferOwner t_owner;
+
+int64_t clockNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+ThreadBuffer* threadBuffer()
+{
+    ThreadBuffer* buffer = t_owner.buffer;
+    if (buffer == nullptr)
+    {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.buffers.emplace_back(new ThreadBuffer());
+        buffer = t_owner.buffer = reg.buffers.back().get();
+        buffer->threadId = reg.nextThreadId++;
+    }
+    uint32_t generation = s_generation.load(std::memory_order_acquire);
+    if (buffer->generation.load(std::memory_order_relaxed) != generation)
+    {
+        buffer->written.store(0, std::memory_order_relaxed);
+        buffer->events.resize(s_eventsPerThread.load(std::memory_order_relaxed));
+        buffer->generation.store(generation, std::memory_order_release);
+    }
+    return buffer;
+}
+
+void appendJsonString(std::string& json, const char* text)
+{
+    json += '"';
+    for (const char* c = text; *c != '\0'; c++)
+    {
+        switch (*c)
+        {
+            case '"':
+                json += "\\\"";
+                break;
+            case '\\':
+                json += "\\\\";
+                break;
+            default:
+                if ((unsigned char)*c < 0x20)
+                {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", *c);
+                    json += escaped;
+                }
+                else
+                {
+                    json += *c;
+                }
+                break;
+        }
+    }
+    json += '"';
+}
+
+// Chrome trace timestamps are in (fractional) microseconds.
+void appendMicroseconds(std::string& json, uint64_t ns)
+{
+    char number[32];
+    snprintf(number,
+             sizeof(number),
+             "%llu.%03u",
+             (unsigned long long)(ns / 1000),
+             (unsigned)(ns % 1000));
+    json += number;
+}
+} // namespace
+
+std::atomic<bool> Trace::s_active{false};
+
+bool Trace::compiledIn()
+{
+#ifdef WITH_RIVE_TRACING
+    return true;
+#else
+    return false;
+#endif
+}
+
+void Trace::start(size_t eventsPerThread)
+{
+    s_active.store(false, std::memory_order_relaxed);
+    s_eventsPerThread.store(std::max(eventsPerThread, (size_t)1), std::memory_order_relaxed);
+    s_startNs.store(clockNs(), std::memory_order_relaxed);
+    s_generation.fetch_add(1, std::memory_order_release);
+    s_active.store(true, std::memory_order_release);
+}
+
+void Trace::stop() { s_active.store(false, std::memory_order_release); }
+
+void Trace::release()
+{
+    s_active.store(false, std::memory_order_release);
+    // Invalidates every buffer's capture, live threads reallocate on their
+    // next event after a start().
+    s_generation.fetch_add(1, std::memory_order_release);
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    auto& buffers = reg.buffers;
+    buffers.erase(std::remove_if(buffers.begin(),
+                                 buffers.end(),
+                                 [](const std::unique_ptr<ThreadBuffer>& buffer) {
+                                     return buffer->exited.load(std::memory_order_acquire);
+                                 }),
+                  buffers.end());
+    for (const auto& buffer : buffers)
+    {
+        buffer->written.store(0, std::memory_order_relaxed);
+        std::vector<TraceEvent>().swap(buffer->events);
+    }
+}
+
+size_t Trace::bufferedBytes()
+{
+    size_t bytes = 0;
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (const auto& buffer : reg.buffers)
+    {
+        bytes += buffer->events.capacity() * sizeof(TraceEvent);
+    }
+    return bytes;
+}
+
+uint64_t Trace::nowNs()
+{
+    int64_t elapsed = clockNs() - s_startNs.load(std::memory_order_relaxed);
+    return elapsed < 0 ? 0 : (uint64_t)elapsed;
+}
+
+void Trace::record(const char* name,
+                   uint64_t startNs,
+                   uint64_t endNs,
+                   const std::string* object)
+{
+    ThreadBuffer* buffer = threadBuffer();
+    uint64_t index = buffer->written.load(std::memory_order_relaxed);
+    TraceEvent& event = buffer->events[index % buffer->events.size()];
+    event.name = name;
+    event.startNs = startNs;
+    event.durationNs = endNs > startNs ? endNs - startNs : 0;
+    event.threadId = buffer->threadId;
+    size_t length = 0;
+    if (object != nullptr)
+    {
+        const size_t maxLength = TraceEvent::maxObjectLength;
+        length = std::min(object->size(), maxLength);
+        // Don't cut a UTF-8 sequence in half.
+        while (length > 0 && length < object->size() && ((*object)[length] & 0xC0) == 0x80)
+        {
+            length--;
+        }
+        memcpy(event.object, object->data(), length);
+    }
+    event.object[length] = '\0';
+    buffer->written.store(index + 1, std::memory_order_release);
+}
+
+std::vector<TraceEvent> Trace::events()
+{
+    std::vector<TraceEvent> events;
+    uint32_t generation = s_generation.load(std::memory_order_acquire);
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (const auto& buffer : reg.buffers)
+    {
+        if (buffer->generation.load(std::memory_order_acquire) != generation)
+        {
+            continue;
+        }
+        uint64_t capacity = buffer->events.size();
+        uint64_t written = buffer->written.load(std::memory_order_acquire);
+        uint64_t first = written > capacity ? written - capacity : 0;
+        size_t start = events.size();
+        for (uint64_t i = first; i < written; i++)
+        {
+            events.push_back(buffer->events[i % capacity]);
+        }
+        // Anything the owner wrapped over while we copied is unreliable.
+        uint64_t writtenAfter = buffer->written.load(std::memory_order_acquire);
+        if (writtenAfter > first + capacity)
+        {
+            uint64_t overwritten = std::min(writtenAfter - capacity - first, written - first);
+            events.erase(events.begin() + start, events.begin() + start + (size_t)overwritten);
+        }
+    }
+    // Outer scopes first when they start together, they're recorded last.
+    std::sort(events.begin(), events.end(), [](const TraceEvent& a, const TraceEvent& b) {
+        return a.startNs != b.startNs ? a.startNs < b.startNs : a.durationNs > b.durationNs;
+    });
+    return events;
+}
+
+std::string Trace::chromeJson() { return chromeJson(events()); }
+
+std::string Trace::chromeJson(const std::vector<TraceEvent>& events)
+{
+    std::string json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    for (size_t i = 0; i < events.size(); i++)
+    {
+        const TraceEvent& event = events[i];
+        json += i == 0 ? "\n" : ",\n";
+        json += "{\"name\":";
+        appendJsonString(json, event.name);
+        json += ",\"cat\":\"rive\",\"ph\":\"X\",\"pid\":1,\"tid\":";
+        json += std::to_string(event.threadId);
+        json += ",\"ts\":";
+        appendMicroseconds(json, event.startNs);
+        json += ",\"dur\":";
+        appendMicroseconds(json, event.durationNs);
+        if (event.object[0] != '\0')
+        {
+            json += ",\"args\":{\"object\":";
+            appendJsonString(json, event.object);
+            json += "}";
+        }
+        json += "}";
+    }
+    json += "\n]}\n";
+    return json;
+}
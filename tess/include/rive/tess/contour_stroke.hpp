@@ -4,6 +4,7 @@
 #include "rive/renderer.hpp"
 #include "rive/math/aabb.hpp"
 #include "rive/math/mat2d.hpp"
+#include "rive/span.hpp"
 #include <vector>
 #include <cstdint>
 
@@ -21,6 +22,13 @@ protected:
     std::vector<std::size_t> m_Offsets;
     uint32_t m_RenderOffset = 0;
 
+    // Per segment unit directions and lengths, computed in bulk before
+    // extruding and kept around to reuse their storage.
+    std::vector<Vec2D> m_segmentDirections;
+    std::vector<float> m_segmentLengths;
+
+    void computeSegments(Span<const Vec2D> points, std::size_t segmentCount);
+
 public:
     const std::vector<Vec2D>& triangleStrip() const { return m_TriangleStrip; }
 
@@ -18,15 +18,9 @@ private:
 
     AABB m_bounds;
     float m_threshold;
-    float m_thresholdSquared;
 
-    void addVertex(Vec2D vertex);
-    void segmentCubic(const Vec2D& from,
-                      const Vec2D& fromOut,
-                      const Vec2D& toIn,
-                      const Vec2D& to,
-                      float t1,
-                      float t2);
+    void segmentCubic(const Vec2D pts[4], float precision);
+    void computeBounds();
 
 public:
     const Span<const Vec2D> contourPoints(uint32_t endOffset = 0) const;
@@ -38,7 +32,11 @@ public:
     void threshold(float value);
     const AABB& bounds() const;
 
-    void contour(const RawPath& rawPath, const Mat2D& transform);
+    /// Flattens rawPath (after applying transform) into line segments.
+    /// deviceScale is the scale from the transformed space to device
+    /// pixels, curves are subdivided so they stay within threshold pixels
+    /// of the true curve on screen.
+    void contour(const RawPath& rawPath, const Mat2D& transform, float deviceScale = 1.0f);
 };
 } // namespace rive
 #endif
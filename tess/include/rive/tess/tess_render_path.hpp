@@ -30,13 +30,52 @@ private:
     bool m_isContourDirty = true;
     bool m_isTriangulationDirty = true;
     Mat2D m_contourTransform;
+    float m_contourDeviceScale = 1.0f;
     bool m_isClosed = false;
 
+    // Scale from this path's space to device pixels, rounded up to a power
+    // of two so small zoom changes don't force re-flattening.
+    float m_deviceScale = 1.0f;
+
+    // Lazily assigned unique id for the current geometry, 0 when the
+    // geometry changed since it was last queried.
+    mutable uint64_t m_geometryVersion = 0;
+
+    // What the current triangles were built from, used to detect when a
+    // rebuilt container references the exact same geometry (possibly under
+    // a different overall transform) and the triangles can be reused.
+    struct TriangulatedSubPath
+    {
+        const TessRenderPath* path;
+        uint64_t geometryVersion;
+        Mat2D transform;
+    };
+    std::vector<TriangulatedSubPath> m_triangulatedSubPaths;
+    std::vector<TriangulatedSubPath> m_candidateSubPaths;
+    bool m_hasTriangulation = false;
+    float m_triangulatedDeviceScale = 1.0f;
+    Mat2D m_triangulationTransform;
+
+    // Scratch storage for indices coming out of libtess2.
+    std::vector<uint16_t> m_tessIndices;
+
+    void markGeometryDirty();
+    void extrudeStroke(ContourStroke* stroke,
+                       StrokeJoin join,
+                       StrokeCap cap,
+                       float strokeWidth,
+                       const Mat2D& transform,
+                       float deviceScale);
+    bool buildTriangulationKey(std::vector<TriangulatedSubPath>& key) const;
+    bool canReuseTriangulation(Mat2D& reuseTransform);
+
 protected:
     std::vector<SubPath> m_subPaths;
     virtual void addTriangles(Span<const Vec2D> vertices, Span<const uint16_t> indices) = 0;
     virtual void setTriangulatedBounds(const AABB& value) = 0;
-    void contour(const Mat2D& transform);
+    /// Called before a fresh triangulation is emitted through addTriangles.
+    virtual void resetTriangles() {}
+    void contour(const Mat2D& transform, float deviceScale);
     void triangulate(TessRenderPath* containerPath);
 
 public:
@@ -58,7 +97,25 @@ public:
     void addRenderPath(RenderPath* path, const Mat2D& transform) override;
 
     const SegmentedContour& segmentedContour() const;
+
+    /// Returns true if new triangles were emitted, false if the previous
+    /// triangulation is still valid (see triangulationTransform).
     bool triangulate();
+
+    /// Transform to draw the current triangles with, relative to this path.
+    /// Identity unless the triangles were reused from a previous
+    /// triangulation of the same geometry under a different transform.
+    const Mat2D& triangulationTransform() const { return m_triangulationTransform; }
+
+    /// Sets the scale from this path's space to device pixels (e.g. the
+    /// scale of the transform it's drawn with). Curves are flattened more
+    /// coarsely when zoomed out and more finely when zoomed in.
+    void deviceScale(float scale);
+    float deviceScale() const { return m_deviceScale; }
+
+    /// Unique id for the current geometry of this path, changes whenever
+    /// the path is rewound or commands are added.
+    uint64_t geometryVersion() const;
     void extrudeStroke(ContourStroke* stroke,
                        StrokeJoin join,
                        StrokeCap cap,
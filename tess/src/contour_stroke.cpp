@@ -1,4 +1,5 @@
 #include "rive/math/math_types.hpp"
+#include "rive/math/simd.hpp"
 #include "rive/tess/contour_stroke.hpp"
 #include "rive/tess/segmented_contour.hpp"
 #include "rive/math/vec2d.hpp"
@@ -9,6 +10,53 @@ using namespace rive;
 
 static const int subdivisionArcLength = 4.0f;
 
+namespace
+{
+// Unit vectors evenly spaced around the circle. Round caps and joins rotate
+// their starting direction by entries in this table instead of calling
+// cos/sin for every step.
+constexpr int unitCircleSteps = 1024;
+struct UnitCircle
+{
+    Vec2D points[unitCircleSteps];
+
+    UnitCircle()
+    {
+        for (int i = 0; i < unitCircleSteps; i++)
+        {
+            float angle = (float)i * (math::PI * 2.0f / unitCircleSteps);
+            points[i] = Vec2D(std::cos(angle), std::sin(angle));
+        }
+    }
+};
+
+const UnitCircle& unitCircle()
+{
+    static UnitCircle circle;
+    return circle;
+}
+
+// Rotates the unit vector direction by angle (radians), snapped to the
+// nearest entry in the unit circle table.
+Vec2D rotate(Vec2D direction, float angle)
+{
+    int index = (int)std::round(angle * (unitCircleSteps / (math::PI * 2.0f)));
+    const Vec2D& r = unitCircle().points[index & (unitCircleSteps - 1)];
+    return Vec2D(direction.x * r.x - direction.y * r.y, direction.x * r.y + direction.y * r.x);
+}
+
+// Counter-clockwise perpendicular.
+Vec2D perpendicular(Vec2D v) { return Vec2D(-v.y, v.x); }
+
+// Sweep (in radians, [0, 2pi)) going clockwise from the unit vector from to
+// the unit vector to.
+float clockwiseSweep(Vec2D from, Vec2D to)
+{
+    float angle = std::acos(std::min(1.0f, std::max(-1.0f, Vec2D::dot(from, to))));
+    return Vec2D::cross(from, to) > 0.0f ? math::PI * 2.0f - angle : angle;
+}
+} // namespace
+
 void ContourStroke::reset()
 {
     m_TriangleStrip.clear();
@@ -28,29 +76,75 @@ bool ContourStroke::nextRenderOffset(std::size_t& start, std::size_t& end)
     return true;
 }
 
+void ContourStroke::computeSegments(Span<const Vec2D> points, std::size_t segmentCount)
+{
+    // Segment i runs from points[i] to points[(i + 1) % points.size()].
+    m_segmentDirections.resize(segmentCount);
+    m_segmentLengths.resize(segmentCount);
+    Vec2D* directions = m_segmentDirections.data();
+    float* lengths = m_segmentLengths.data();
+    const std::size_t pointCount = points.size();
+
+    // Two segments at a time while we have three consecutive points.
+    std::size_t i = 0;
+    for (; i + 2 < pointCount && i + 1 < segmentCount; i += 2)
+    {
+        float4 from = simd::load4f(&points[i].x);
+        float4 to = simd::load4f(&points[i + 1].x);
+        float4 diff = to - from;
+        float4 diffSquared = diff * diff;
+        // {len0, len0, len1, len1}
+        float4 length = simd::sqrt(
+            diffSquared + float4{diffSquared.y, diffSquared.x, diffSquared.w, diffSquared.z});
+        lengths[i] = length.x;
+        lengths[i + 1] = length.z;
+        simd::store(&directions[i].x, diff / length);
+    }
+    for (; i < segmentCount; i++)
+    {
+        Vec2D diff = points[(i + 1) % pointCount] - points[i];
+        float length = diff.length();
+        lengths[i] = length;
+        directions[i] = diff / length;
+    }
+}
+
 void ContourStroke::extrude(const SegmentedContour* contour,
                             bool isClosed,
                             StrokeJoin join,
                             StrokeCap cap,
                             float strokeWidth)
 {
-    auto contourPoints = contour->contourPoints();
-    std::vector<Vec2D> points(contourPoints.begin(), contourPoints.end());
+    auto points = contour->contourPoints();
 
     auto pointCount = points.size();
     if (pointCount < 2)
     {
         return;
     }
+
+    pointCount -= isClosed ? 1 : 0;
+    std::size_t adjustedPointCount = isClosed ? pointCount + 1 : pointCount;
+    if (pointCount < 2)
+    {
+        // Closed contour of a single point, nothing to stroke.
+        return;
+    }
+    computeSegments(Span<const Vec2D>(points.data(), pointCount),
+                    isClosed ? pointCount : pointCount - 1);
+    const Vec2D* directions = m_segmentDirections.data();
+    const float* lengths = m_segmentLengths.data();
+
+    // Every point emits at least two vertices, round joins and caps add
+    // more as they go.
+    m_TriangleStrip.reserve(m_TriangleStrip.size() + adjustedPointCount * 2 + 8);
+
     auto startOffset = m_TriangleStrip.size();
     Vec2D lastPoint = points[0];
-    Vec2D lastDiff = points[1] - lastPoint;
-
-    float lastLength = lastDiff.length();
-    Vec2D lastDiffNormalized = lastDiff / lastLength;
+    float lastLength = lengths[0];
+    Vec2D lastDiffNormalized = directions[0];
 
-    Vec2D perpendicularStrokeDiff =
-        Vec2D(lastDiffNormalized.y * -strokeWidth, lastDiffNormalized.x * strokeWidth);
+    Vec2D perpendicularStrokeDiff = perpendicular(lastDiffNormalized) * strokeWidth;
     Vec2D lastA = lastPoint + perpendicularStrokeDiff;
     Vec2D lastB = lastPoint - perpendicularStrokeDiff;
 
@@ -69,19 +163,16 @@ void ContourStroke::extrude(const SegmentedContour* contour,
             }
             case StrokeCap::round:
             {
-                Vec2D capDirection = Vec2D(-lastDiffNormalized.y, lastDiffNormalized.x);
+                Vec2D capDirection = perpendicular(lastDiffNormalized);
                 float arcLength = std::abs(math::PI * strokeWidth);
                 int steps = (int)std::ceil(arcLength / subdivisionArcLength);
-                float angleTo = std::atan2(capDirection.y, capDirection.x);
                 float inc = math::PI / steps;
-                float angle = angleTo;
                 // make sure to draw the full cap due triangle strip
                 for (int j = 0; j <= steps; j++)
                 {
                     m_TriangleStrip.push_back(lastPoint);
-                    m_TriangleStrip.push_back(Vec2D(lastPoint.x + std::cos(angle) * strokeWidth,
-                                                    lastPoint.y + std::sin(angle) * strokeWidth));
-                    angle += inc;
+                    m_TriangleStrip.push_back(lastPoint +
+                                              rotate(capDirection, j * inc) * strokeWidth);
                 }
                 break;
             }
@@ -92,38 +183,30 @@ void ContourStroke::extrude(const SegmentedContour* contour,
     m_TriangleStrip.push_back(lastA);
     m_TriangleStrip.push_back(lastB);
 
-    pointCount -= isClosed ? 1 : 0;
-    std::size_t adjustedPointCount = isClosed ? pointCount + 1 : pointCount;
-
     for (std::size_t i = 1; i < adjustedPointCount; i++)
     {
         const Vec2D& point = points[i % pointCount];
-        Vec2D diff, diffNormalized, next;
+        Vec2D diffNormalized;
         float length;
         if (i < adjustedPointCount - 1 || isClosed)
         {
-            diff = (next = points[(i + 1) % pointCount]) - point;
-            length = diff.length();
-            diffNormalized = diff / length;
+            length = lengths[i % pointCount];
+            diffNormalized = directions[i % pointCount];
         }
         else
         {
-            diff = lastDiff;
-            next = point;
             length = lastLength;
             diffNormalized = lastDiffNormalized;
         }
 
         // perpendicular dx
-        float pdx0 = -lastDiffNormalized.y;
-        float pdy0 = lastDiffNormalized.x;
-        float pdx1 = -diffNormalized.y;
-        float pdy1 = diffNormalized.x;
+        Vec2D lastPerpendicular = perpendicular(lastDiffNormalized);
+        Vec2D nextPerpendicular = perpendicular(diffNormalized);
 
         // Compute bisector without a normalization by averaging perpendicular
         // diffs.
-        Vec2D bisector((pdx0 + pdx1) * 0.5f, (pdy0 + pdy1) * 0.5f);
-        float cross = Vec2D::cross(diff, lastDiff);
+        Vec2D bisector = (lastPerpendicular + nextPerpendicular) * 0.5f;
+        float cross = Vec2D::cross(diffNormalized, lastDiffNormalized);
         float dot = Vec2D::dot(bisector, bisector);
 
         float lengthLimit = std::min(length, lastLength);
@@ -146,6 +229,8 @@ void ContourStroke::extrude(const SegmentedContour* contour,
             bisector *= strokeWidth;
         }
 
+        Vec2D ldPStroke = lastPerpendicular * strokeWidth;
+        Vec2D dPStroke = nextPerpendicular * strokeWidth;
         if (!bevel)
         {
             Vec2D c = point + bisector;
@@ -161,36 +246,23 @@ void ContourStroke::extrude(const SegmentedContour* contour,
             {
                 // Overlap the inner (in this case right) edge (sometimes called
                 // miter inner).
-                Vec2D c1 = point + Vec2D(lastDiffNormalized.y * -strokeWidth,
-                                         lastDiffNormalized.x * strokeWidth);
-                Vec2D c2 =
-                    point + Vec2D(diffNormalized.y * -strokeWidth, diffNormalized.x * strokeWidth);
-
-                m_TriangleStrip.push_back(c1);
+                m_TriangleStrip.push_back(point + ldPStroke);
                 m_TriangleStrip.push_back(d);
-                m_TriangleStrip.push_back(c2);
+                m_TriangleStrip.push_back(point + dPStroke);
                 m_TriangleStrip.push_back(d);
             }
             else
             {
                 // Overlap the inner (in this case left) edge (sometimes called
                 // miter inner).
-                Vec2D d1 = point - Vec2D(lastDiffNormalized.y * -strokeWidth,
-                                         lastDiffNormalized.x * strokeWidth);
-                Vec2D d2 =
-                    point - Vec2D(diffNormalized.y * -strokeWidth, diffNormalized.x * strokeWidth);
-
                 m_TriangleStrip.push_back(c);
-                m_TriangleStrip.push_back(d1);
+                m_TriangleStrip.push_back(point - ldPStroke);
                 m_TriangleStrip.push_back(c);
-                m_TriangleStrip.push_back(d2);
+                m_TriangleStrip.push_back(point - dPStroke);
             }
         }
         else
         {
-            Vec2D ldPStroke =
-                Vec2D(lastDiffNormalized.y * -strokeWidth, lastDiffNormalized.x * strokeWidth);
-            Vec2D dPStroke = Vec2D(diffNormalized.y * -strokeWidth, diffNormalized.x * strokeWidth);
             if (cross <= 0)
             {
                 // Bevel the outer (left in this case) edge.
@@ -215,29 +287,20 @@ void ContourStroke::extrude(const SegmentedContour* contour,
                 m_TriangleStrip.push_back(b);
                 if (join == StrokeJoin::round)
                 {
-                    const Vec2D& pivot = bevelInner ? point : a1;
-                    Vec2D toPrev = bn - point;
-                    Vec2D toNext = b - point;
-                    float angleFrom = std::atan2(toPrev.y, toPrev.x);
-                    float angleTo = std::atan2(toNext.y, toNext.x);
-                    if (angleTo > angleFrom)
-                    {
-                        angleTo -= math::PI * 2.0f;
-                    }
-                    float range = angleTo - angleFrom;
+                    const Vec2D pivot = bevelInner ? point : a1;
+                    // Sweep from bn back to b.
+                    Vec2D toPrev = -nextPerpendicular;
+                    Vec2D toNext = -lastPerpendicular;
+                    float range = clockwiseSweep(toPrev, toNext);
                     float arcLength = std::abs(range * strokeWidth);
                     int steps = std::ceil(arcLength / subdivisionArcLength);
 
                     float inc = range / steps;
-                    float angle = angleTo - inc;
                     for (int j = 0; j < steps - 1; j++)
                     {
                         m_TriangleStrip.push_back(pivot);
-                        m_TriangleStrip.emplace_back(
-                            Vec2D(point.x + std::cos(angle) * strokeWidth,
-                                  point.y + std::sin(angle) * strokeWidth));
-
-                        angle -= inc;
+                        m_TriangleStrip.push_back(point +
+                                                  rotate(toNext, (j + 1) * inc) * strokeWidth);
                     }
                 }
                 m_TriangleStrip.push_back(a2);
@@ -267,29 +330,20 @@ void ContourStroke::extrude(const SegmentedContour* contour,
 
                 if (join == StrokeJoin::round)
                 {
-                    const Vec2D& pivot = bevelInner ? point : b1;
-                    Vec2D toPrev = a - point;
-                    Vec2D toNext = an - point;
-                    float angleFrom = std::atan2(toPrev.y, toPrev.x);
-                    float angleTo = std::atan2(toNext.y, toNext.x);
-                    if (angleTo > angleFrom)
-                    {
-                        angleTo -= math::PI * 2.0f;
-                    }
-
-                    float range = angleTo - angleFrom;
+                    const Vec2D pivot = bevelInner ? point : b1;
+                    // Sweep from a to an.
+                    Vec2D toPrev = lastPerpendicular;
+                    Vec2D toNext = nextPerpendicular;
+                    float range = clockwiseSweep(toPrev, toNext);
                     float arcLength = std::abs(range * strokeWidth);
                     int steps = std::ceil(arcLength / subdivisionArcLength);
                     float inc = range / steps;
 
-                    float angle = angleFrom + inc;
                     for (int j = 0; j < steps - 1; j++)
                     {
-                        m_TriangleStrip.emplace_back(
-                            Vec2D(point.x + std::cos(angle) * strokeWidth,
-                                  point.y + std::sin(angle) * strokeWidth));
+                        m_TriangleStrip.push_back(point +
+                                                  rotate(toPrev, -(j + 1) * inc) * strokeWidth);
                         m_TriangleStrip.push_back(pivot);
-                        angle += inc;
                     }
                 }
                 m_TriangleStrip.push_back(an);
@@ -298,7 +352,6 @@ void ContourStroke::extrude(const SegmentedContour* contour,
         }
 
         lastPoint = point;
-        lastDiff = diff;
         lastDiffNormalized = diffNormalized;
     }
 
@@ -326,19 +379,16 @@ void ContourStroke::extrude(const SegmentedContour* contour,
             }
             case StrokeCap::round:
             {
-                Vec2D capDirection = Vec2D(-lastDiffNormalized.y, lastDiffNormalized.x);
+                Vec2D capDirection = perpendicular(lastDiffNormalized);
                 float arcLength = std::abs(math::PI * strokeWidth);
                 int steps = (int)std::ceil(arcLength / subdivisionArcLength);
-                float angleTo = std::atan2(capDirection.y, capDirection.x);
                 float inc = math::PI / steps;
-                float angle = angleTo;
                 // make sure to draw the full cap due triangle strip
                 for (int j = 0; j <= steps; j++)
                 {
                     m_TriangleStrip.push_back(lastPoint);
-                    m_TriangleStrip.push_back(Vec2D(lastPoint.x + std::cos(angle) * strokeWidth,
-                                                    lastPoint.y + std::sin(angle) * strokeWidth));
-                    angle -= inc;
+                    m_TriangleStrip.push_back(lastPoint +
+                                              rotate(capDirection, -j * inc) * strokeWidth);
                 }
                 break;
             }
@@ -348,4 +398,4 @@ void ContourStroke::extrude(const SegmentedContour* contour,
     }
 
     m_Offsets.push_back(m_TriangleStrip.size());
-}
\ No newline at end of file
+}
@@ -1,26 +1,48 @@
 #include "rive/tess/segmented_contour.hpp"
 #include "rive/math/raw_path.hpp"
-#include "rive/math/cubic_utilities.hpp"
+#include "rive/math/simd.hpp"
+#include "rive/math/wangs_formula.hpp"
 
 using namespace rive;
 
 SegmentedContour::SegmentedContour(float threshold) :
     m_bounds(AABB::forExpansion()),
-    m_threshold(threshold),
-    m_thresholdSquared(threshold * threshold)
+    m_threshold(threshold)
 {}
 
 float SegmentedContour::threshold() const { return m_threshold; }
-void SegmentedContour::threshold(float value)
-{
-    m_threshold = value;
-    m_thresholdSquared = value * value;
-}
+void SegmentedContour::threshold(float value) { m_threshold = value; }
 const AABB& SegmentedContour::bounds() const { return m_bounds; }
-void SegmentedContour::addVertex(Vec2D vertex)
+
+void SegmentedContour::computeBounds()
 {
-    m_contourPoints.push_back(vertex);
-    AABB::expandTo(m_bounds, vertex);
+    size_t count = m_contourPoints.size();
+    if (count == 0)
+    {
+        m_bounds = AABB::forExpansion();
+        return;
+    }
+    const Vec2D* points = m_contourPoints.data();
+    float4 mins, maxes;
+    size_t i;
+    if (count & 1)
+    {
+        mins = maxes = simd::load2f(&points[0].x).xyxy;
+        i = 1;
+    }
+    else
+    {
+        mins = maxes = simd::load4f(&points[0].x);
+        i = 2;
+    }
+    for (; i < count; i += 2)
+    {
+        float4 pts = simd::load4f(&points[i].x);
+        mins = simd::min(mins, pts);
+        maxes = simd::max(maxes, pts);
+    }
+    simd::store(&m_bounds.minX, simd::min(mins.xy, mins.zw));
+    simd::store(&m_bounds.maxX, simd::max(maxes.xy, maxes.zw));
 }
 
 const std::size_t SegmentedContour::contourSize() const { return m_contourPoints.size(); }
@@ -31,37 +53,68 @@ const Span<const Vec2D> SegmentedContour::contourPoints(uint32_t endOffset) cons
     return Span<const Vec2D>(m_contourPoints.data(), m_contourPoints.size() - endOffset);
 }
 
-void SegmentedContour::segmentCubic(const Vec2D& from,
-                                    const Vec2D& fromOut,
-                                    const Vec2D& toIn,
-                                    const Vec2D& to,
-                                    float t1,
-                                    float t2)
+// Upper bound on the number of segments a single cubic is flattened into.
+static const int maxCubicSegments = 1024;
+
+void SegmentedContour::segmentCubic(const Vec2D pts[4], float precision)
 {
-    if (CubicUtilities::shouldSplitCubic(from, fromOut, toIn, to, m_threshold))
+    // Compute how many segments we need up front, then evaluate the cubic
+    // at evenly spaced t with forward differencing (three adds per point).
+    // Written so a NaN count (from non-finite points) fails both compares
+    // and falls to a single segment rather than an undefined int cast.
+    float segmentCount = ceilf(wangs_formula::cubic(pts, precision));
+    int n = 1;
+    if (segmentCount >= (float)maxCubicSegments)
+    {
+        n = maxCubicSegments;
+    }
+    else if (segmentCount > 1.0f)
     {
-        float halfT = (t1 + t2) / 2.0f;
+        n = (int)segmentCount;
+    }
 
-        Vec2D hull[6];
-        CubicUtilities::computeHull(from, fromOut, toIn, to, 0.5f, hull);
+    float2 p0 = simd::load2f(&pts[0].x);
+    float2 p1 = simd::load2f(&pts[1].x);
+    float2 p2 = simd::load2f(&pts[2].x);
+    float2 p3 = simd::load2f(&pts[3].x);
 
-        segmentCubic(from, hull[0], hull[3], hull[5], t1, halfT);
+    // p(t) = a*t^3 + b*t^2 + c*t + p0
+    float2 a = p3 + 3.0f * (p1 - p2) - p0;
+    float2 b = 3.0f * (p0 - 2.0f * p1 + p2);
+    float2 c = 3.0f * (p1 - p0);
 
-        segmentCubic(hull[5], hull[4], hull[2], to, halfT, t2);
-    }
-    else
+    float h = 1.0f / (float)n;
+    float h2 = h * h;
+    float h3 = h2 * h;
+    float2 d1 = a * h3 + b * h2 + c * h;
+    float2 d2 = 6.0f * a * h3 + 2.0f * b * h2;
+    float2 d3 = 6.0f * a * h3;
+
+    size_t offset = m_contourPoints.size();
+    m_contourPoints.resize(offset + n);
+    Vec2D* out = m_contourPoints.data() + offset;
+    float2 point = p0;
+    for (int i = 0; i < n - 1; i++)
     {
-        if (Vec2D::distanceSquared(from, to) > m_thresholdSquared)
-        {
-            addVertex(Vec2D(CubicUtilities::cubicAt(t2, from.x, fromOut.x, toIn.x, to.x),
-                            CubicUtilities::cubicAt(t2, from.y, fromOut.y, toIn.y, to.y)));
-        }
+        point += d1;
+        d1 += d2;
+        d2 += d3;
+        simd::store(&out[i].x, point);
     }
+    // Land exactly on the end point so error doesn't accumulate into the
+    // next segment.
+    out[n - 1] = pts[3];
 }
 
-void SegmentedContour::contour(const RawPath& rawPath, const Mat2D& transform)
+void SegmentedContour::contour(const RawPath& rawPath, const Mat2D& transform, float deviceScale)
 {
     m_contourPoints.clear();
+    // Most contours are dominated by line segments, start with room for a
+    // vertex per path point.
+    m_contourPoints.reserve(rawPath.points().size());
+
+    // Wang's formula precision is the inverse of the allowed error.
+    float precision = deviceScale / m_threshold;
 
     // Possible perf consideration: could add second path that doesn't transform
     // if transform is the identity.
@@ -73,19 +126,18 @@ void SegmentedContour::contour(const RawPath& rawPath, const Mat2D& transform)
         switch (verb)
         {
             case PathVerb::move:
-                addVertex(transform * pts[0]);
+                m_contourPoints.push_back(transform * pts[0]);
                 break;
             case PathVerb::line:
-                addVertex(transform * pts[1]);
+                m_contourPoints.push_back(transform * pts[1]);
                 break;
             case PathVerb::cubic:
-                segmentCubic(transform * pts[0],
-                             transform * pts[1],
-                             transform * pts[2],
-                             transform * pts[3],
-                             0.0f,
-                             1.0f);
+            {
+                Vec2D cubic[4];
+                transform.mapPoints(cubic, pts, 4);
+                segmentCubic(cubic, precision);
                 break;
+            }
             case PathVerb::close:
                 break;
             case PathVerb::quad:
@@ -94,4 +146,6 @@ void SegmentedContour::contour(const RawPath& rawPath, const Mat2D& transform)
                 break;
         }
     }
+
+    computeBounds();
 }
@@ -3,6 +3,8 @@
 #include "rive/tess/tess_render_path.hpp"
 #include "rive/tess/contour_stroke.hpp"
 #include "generated/shader.h"
+#include <algorithm>
+#include <cmath>
 #include <unordered_set>
 
 using namespace rive;
@@ -53,9 +55,8 @@ protected:
     }
 
 public:
-    void rewind() override
+    void resetTriangles() override
     {
-        TessRenderPath::rewind();
         m_vertices.clear();
         m_indices.clear();
     }
@@ -76,7 +77,8 @@ public:
         sg_draw(start < 2 ? 0 : (start - 2) * 3, end - start < 2 ? 0 : (end - start - 2) * 3, 1);
     }
 
-    void drawFill()
+    // Re-triangulates and uploads the fill if the geometry changed.
+    void updateFillBuffers()
     {
         if (triangulate())
         {
@@ -107,7 +109,29 @@ public:
                     },
             });
         }
+    }
 
+    // Accounts for fill triangles that were reused from a triangulation
+    // built under a different transform (see
+    // TessRenderPath::triangulationTransform).
+    void applyFillTransform(vs_path_params_t& vertexUniforms) const
+    {
+        const Mat2D& local = triangulationTransform();
+        if (local == Mat2D())
+        {
+            return;
+        }
+        vertexUniforms.mvp *= local;
+        // Gradients are evaluated against the vertex positions, map them
+        // back into the space the triangles were built in.
+        Mat2D inverse = local.invertOrIdentity();
+        vertexUniforms.gradientStart = inverse * vertexUniforms.gradientStart;
+        vertexUniforms.gradientEnd = inverse * vertexUniforms.gradientEnd;
+    }
+
+    void drawFill()
+    {
+        updateFillBuffers();
         if (m_vertexBuffer.id == 0)
         {
             return;
@@ -817,6 +841,11 @@ public:
         {
             m_shader->bind(vertexUniforms, m_uniforms);
         }
+        if (m_stroke == nullptr)
+        {
+            path->updateFillBuffers();
+            path->applyFillTransform(vertexUniforms);
+        }
 
         sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_vs_path_params, SG_RANGE_REF(vertexUniforms));
         sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_fs_path_uniforms, SG_RANGE_REF(m_uniforms));
@@ -992,6 +1021,8 @@ void SokolTessRenderer::applyClipping()
             LITE_RTTI_CAST_OR_CONTINUE(sokolPath, SokolRenderPath*, appliedPath.path());
             setPipeline(m_decClipPipeline);
             vs_params.mvp = m_Projection * appliedPath.transform();
+            sokolPath->updateFillBuffers();
+            sokolPath->applyFillTransform(vs_params);
             sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_vs_path_params, SG_RANGE_REF(vs_params));
             sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_fs_path_uniforms, SG_RANGE_REF(uniforms));
             sokolPath->drawFill();
@@ -1010,6 +1041,8 @@ void SokolTessRenderer::applyClipping()
         LITE_RTTI_CAST_OR_CONTINUE(sokolPath, SokolRenderPath*, nextClipPath.path());
         setPipeline(m_incClipPipeline);
         vs_params.mvp = m_Projection * nextClipPath.transform();
+        sokolPath->updateFillBuffers();
+        sokolPath->applyFillTransform(vs_params);
         sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_vs_path_params, SG_RANGE_REF(vs_params));
         sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_fs_path_uniforms, SG_RANGE_REF(uniforms));
         sokolPath->drawFill();
@@ -1042,6 +1075,10 @@ void SokolTessRenderer::drawPath(RenderPath* path, RenderPaint* paint)
     vs_path_params_t vs_params = {.fillType = 0};
     const Mat2D& world = transform();
 
+    // Let the path flatten its curves for the scale it's drawn at.
+    sokolPath->deviceScale(std::sqrt(std::max(world[0] * world[0] + world[1] * world[1],
+                                              world[2] * world[2] + world[3] * world[3])));
+
     vs_params.mvp = m_Projection * world;
     switch (sokolPaint->blendMode())
     {
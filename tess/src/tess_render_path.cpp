@@ -1,8 +1,15 @@
 #include "rive/tess/tess_render_path.hpp"
 #include "rive/tess/contour_stroke.hpp"
+#include "rive/math/math_types.hpp"
 #include "tesselator.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
 
 static const float contourThreshold = 1.0f;
+static const float minDeviceScale = 1.0f / 64.0f;
+static const float maxDeviceScale = 64.0f;
 
 using namespace rive;
 TessRenderPath::TessRenderPath() : m_segmentedContour(contourThreshold) {}
@@ -14,31 +21,80 @@ TessRenderPath::TessRenderPath(RawPath& rawPath, FillRule fillRule) :
 
 TessRenderPath::~TessRenderPath() {}
 
+void TessRenderPath::markGeometryDirty()
+{
+    m_isContourDirty = m_isTriangulationDirty = true;
+    m_geometryVersion = 0;
+}
+
+uint64_t TessRenderPath::geometryVersion() const
+{
+    // Versions are unique across all paths so a recycled path pointer can
+    // never alias a stale cache entry.
+    static std::atomic<uint64_t> nextGeometryVersion(1);
+    if (m_geometryVersion == 0)
+    {
+        m_geometryVersion = nextGeometryVersion.fetch_add(1, std::memory_order_relaxed);
+    }
+    return m_geometryVersion;
+}
+
+void TessRenderPath::deviceScale(float scale)
+{
+    if (!(scale > 0.0f) || std::isinf(scale))
+    {
+        scale = 1.0f;
+    }
+    // Keep the current bucket while the scale stays within it.
+    if (scale <= m_deviceScale && scale > m_deviceScale * 0.5f)
+    {
+        return;
+    }
+    float bucket = std::exp2(std::ceil(std::log2(scale)));
+    bucket = std::min(std::max(bucket, minDeviceScale), maxDeviceScale);
+    if (bucket != m_deviceScale)
+    {
+        m_deviceScale = bucket;
+        m_isTriangulationDirty = true;
+    }
+}
+
 void TessRenderPath::rewind()
 {
     m_rawPath.rewind();
     m_subPaths.clear();
-    m_isContourDirty = m_isTriangulationDirty = true;
+    markGeometryDirty();
     m_isClosed = false;
 }
 
 void TessRenderPath::fillRule(FillRule value) { m_fillRule = value; }
 
-void TessRenderPath::moveTo(float x, float y) { m_rawPath.moveTo(x, y); }
-void TessRenderPath::lineTo(float x, float y) { m_rawPath.lineTo(x, y); }
+void TessRenderPath::moveTo(float x, float y)
+{
+    m_rawPath.moveTo(x, y);
+    markGeometryDirty();
+}
+void TessRenderPath::lineTo(float x, float y)
+{
+    m_rawPath.lineTo(x, y);
+    markGeometryDirty();
+}
 void TessRenderPath::cubicTo(float ox, float oy, float ix, float iy, float x, float y)
 {
     m_rawPath.cubicTo(ox, oy, ix, iy, x, y);
+    markGeometryDirty();
 }
 void TessRenderPath::close()
 {
     m_rawPath.close();
     m_isClosed = true;
+    markGeometryDirty();
 }
 
 void TessRenderPath::addRenderPath(RenderPath* path, const Mat2D& transform)
 {
     m_subPaths.emplace_back(SubPath(path, transform));
+    markGeometryDirty();
 }
 
 const SegmentedContour& TessRenderPath::segmentedContour() const { return m_segmentedContour; }
@@ -63,6 +119,154 @@ template <> struct nth<1, Vec2D>
 
 const RawPath& TessRenderPath::rawPath() const { return m_rawPath; }
 
+namespace
+{
+// libtess2 tessellators can be fed new contours once they've finished a
+// tessellation, so keep a few around instead of allocating a new one (and
+// all of its internal buckets) for every multi-path triangulation.
+class TessellatorPool
+{
+public:
+    ~TessellatorPool()
+    {
+        for (auto tess : m_available)
+        {
+            tessDeleteTess(tess);
+        }
+    }
+
+    TESStesselator* acquire()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_available.empty())
+            {
+                TESStesselator* tess = m_available.back();
+                m_available.pop_back();
+                return tess;
+            }
+        }
+        return tessNewTess(nullptr);
+    }
+
+    void release(TESStesselator* tess)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_available.size() < maxPooledTessellators)
+            {
+                m_available.push_back(tess);
+                return;
+            }
+        }
+        tessDeleteTess(tess);
+    }
+
+private:
+    static const size_t maxPooledTessellators = 4;
+    std::mutex m_mutex;
+    std::vector<TESStesselator*> m_available;
+};
+
+TessellatorPool& tessellatorPool()
+{
+    static TessellatorPool pool;
+    return pool;
+}
+
+bool nearlyEqual(const Mat2D& a, const Mat2D& b)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        if (!math::nearly_equal(a[i], b[i], 1e-5f))
+        {
+            return false;
+        }
+    }
+    // Translation is in path units, allow a slightly larger drift.
+    return math::nearly_equal(a[4], b[4], 1e-3f) && math::nearly_equal(a[5], b[5], 1e-3f);
+}
+
+// Rotation, uniform scale, reflection and translation. Gradients are mapped
+// through the inverse of a reused triangulation's transform, which only
+// preserves their parametrization for similarity transforms.
+bool isSimilarity(const Mat2D& m)
+{
+    return (math::nearly_equal(m[0], m[3], 1e-5f) && math::nearly_equal(m[1], -m[2], 1e-5f)) ||
+           (math::nearly_equal(m[0], -m[3], 1e-5f) && math::nearly_equal(m[1], m[2], 1e-5f));
+}
+} // namespace
+
+bool TessRenderPath::buildTriangulationKey(std::vector<TriangulatedSubPath>& key) const
+{
+    key.clear();
+    if (m_subPaths.empty())
+    {
+        key.push_back({this, geometryVersion(), Mat2D()});
+        return true;
+    }
+    for (const SubPath& subPath : m_subPaths)
+    {
+        auto subRenderPath = static_cast<const TessRenderPath*>(subPath.path());
+        if (subRenderPath->isContainer())
+        {
+            // Nested containers are rebuilt wholesale, we can't key them.
+            return false;
+        }
+        key.push_back({subRenderPath, subRenderPath->geometryVersion(), subPath.transform()});
+    }
+    return true;
+}
+
+bool TessRenderPath::canReuseTriangulation(Mat2D& reuseTransform)
+{
+    if (!m_hasTriangulation || m_triangulatedDeviceScale != m_deviceScale ||
+        m_candidateSubPaths.size() != m_triangulatedSubPaths.size())
+    {
+        return false;
+    }
+    for (size_t i = 0, count = m_candidateSubPaths.size(); i < count; i++)
+    {
+        const TriangulatedSubPath& candidate = m_candidateSubPaths[i];
+        const TriangulatedSubPath& triangulated = m_triangulatedSubPaths[i];
+        if (candidate.path != triangulated.path ||
+            candidate.geometryVersion != triangulated.geometryVersion)
+        {
+            return false;
+        }
+    }
+
+    // Same geometry, see if every sub-path moved by the same transform.
+    Mat2D inverse;
+    if (m_candidateSubPaths.empty() || !m_triangulatedSubPaths[0].transform.invert(&inverse))
+    {
+        return false;
+    }
+    Mat2D delta = m_candidateSubPaths[0].transform * inverse;
+    if (!isSimilarity(delta))
+    {
+        return false;
+    }
+    // The triangles were flattened for m_triangulatedDeviceScale. Scaling
+    // them down only makes them finer than needed, scaling them up past it
+    // would show their segments.
+    float scale = std::sqrt(delta[0] * delta[0] + delta[1] * delta[1]);
+    if (m_deviceScale * scale > m_triangulatedDeviceScale * (1.0f + 1e-5f))
+    {
+        return false;
+    }
+    for (size_t i = 1, count = m_candidateSubPaths.size(); i < count; i++)
+    {
+        if (!nearlyEqual(delta * m_triangulatedSubPaths[i].transform,
+                         m_candidateSubPaths[i].transform))
+        {
+            return false;
+        }
+    }
+    reuseTransform = delta;
+    return true;
+}
+
 void* stdAlloc(void* userData, unsigned int size)
 {
     int* allocated = (int*)userData;
@@ -84,7 +288,23 @@ bool TessRenderPath::triangulate()
         return false;
     }
     m_isTriangulationDirty = false;
+
+    Mat2D reuseTransform;
+    bool isKeyed = buildTriangulationKey(m_candidateSubPaths);
+    if (isKeyed && canReuseTriangulation(reuseTransform))
+    {
+        // The geometry hasn't changed, keep the triangles we have and let
+        // the renderer apply the difference in transform.
+        m_triangulationTransform = reuseTransform;
+        return false;
+    }
+
+    resetTriangles();
     triangulate(this);
+    m_triangulationTransform = Mat2D();
+    m_triangulatedSubPaths.swap(m_candidateSubPaths);
+    m_triangulatedDeviceScale = m_deviceScale;
+    m_hasTriangulation = isKeyed;
     return true;
 }
 
@@ -99,7 +319,7 @@ void TessRenderPath::triangulate(TessRenderPath* containerPath)
         if (!empty())
         {
             Mat2D identity;
-            contour(identity);
+            contour(identity, containerPath->m_deviceScale);
 
             bounds = m_segmentedContour.bounds();
 
@@ -124,7 +344,7 @@ void TessRenderPath::triangulate(TessRenderPath* containerPath)
         else if (!subRenderPath->empty())
         {
             // Yes, it's a single path with commands, triangulate it.
-            subRenderPath->contour(subPath.transform());
+            subRenderPath->contour(subPath.transform(), containerPath->m_deviceScale);
             const SegmentedContour& segmentedContour = subRenderPath->segmentedContour();
             auto contour = segmentedContour.contourPoints();
             auto contours = rive::make_span(&contour, 1);
@@ -148,9 +368,9 @@ void TessRenderPath::triangulate(TessRenderPath* containerPath)
             {
                 if (tess == nullptr)
                 {
-                    tess = tessNewTess(nullptr);
+                    tess = tessellatorPool().acquire();
                 }
-                subRenderPath->contour(subPath.transform());
+                subRenderPath->contour(subPath.transform(), containerPath->m_deviceScale);
                 const SegmentedContour& segmentedContour = subRenderPath->segmentedContour();
                 auto contour = segmentedContour.contourPoints();
                 tessAddContour(tess, 2, contour.data(), sizeof(float) * 2, contour.size());
@@ -167,33 +387,36 @@ void TessRenderPath::triangulate(TessRenderPath* containerPath)
                 auto elems = tessGetElements(tess);
                 auto nelems = tessGetElementCount(tess);
 
-                std::vector<uint16_t> indices;
-                for (int i = 0; i < nelems * 3; i++)
-                {
-                    indices.push_back(elems[i]);
-                }
+                m_tessIndices.assign(elems, elems + nelems * 3);
 
                 containerPath->addTriangles(
                     Span<const rive::Vec2D>(reinterpret_cast<const Vec2D*>(verts), nverts),
-                    indices);
+                    m_tessIndices);
+                tessellatorPool().release(tess);
+            }
+            else
+            {
+                // Don't recycle a tessellator that failed (e.g. out of memory).
+                tessDeleteTess(tess);
             }
-            tessDeleteTess(tess);
         }
     }
 
     containerPath->setTriangulatedBounds(bounds);
 }
 
-void TessRenderPath::contour(const Mat2D& transform)
+void TessRenderPath::contour(const Mat2D& transform, float deviceScale)
 {
-    if (!m_isContourDirty && transform == m_contourTransform)
+    if (!m_isContourDirty && transform == m_contourTransform &&
+        deviceScale == m_contourDeviceScale)
     {
         return;
     }
 
     m_isContourDirty = false;
     m_contourTransform = transform;
-    m_segmentedContour.contour(m_rawPath, transform);
+    m_contourDeviceScale = deviceScale;
+    m_segmentedContour.contour(m_rawPath, transform, deviceScale);
 }
 
 void TessRenderPath::extrudeStroke(ContourStroke* stroke,
@@ -201,18 +424,28 @@ void TessRenderPath::extrudeStroke(ContourStroke* stroke,
                                    StrokeCap cap,
                                    float strokeWidth,
                                    const Mat2D& transform)
+{
+    extrudeStroke(stroke, join, cap, strokeWidth, transform, m_deviceScale);
+}
+
+void TessRenderPath::extrudeStroke(ContourStroke* stroke,
+                                   StrokeJoin join,
+                                   StrokeCap cap,
+                                   float strokeWidth,
+                                   const Mat2D& transform,
+                                   float deviceScale)
 {
     if (isContainer())
     {
         for (auto& subPath : m_subPaths)
         {
             static_cast<TessRenderPath*>(subPath.path())
-                ->extrudeStroke(stroke, join, cap, strokeWidth, subPath.transform());
+                ->extrudeStroke(stroke, join, cap, strokeWidth, subPath.transform(), deviceScale);
         }
         return;
     }
 
-    contour(transform);
+    contour(transform, deviceScale);
     stroke->extrude(&m_segmentedContour, m_isClosed, join, cap, strokeWidth);
 }
 
@@ -0,0 +1,61 @@
+#include <catch.hpp>
+#include "rive/math/math_types.hpp"
+#include "rive/math/raw_path.hpp"
+#include "rive/tess/contour_stroke.hpp"
+#include "rive/tess/segmented_contour.hpp"
+
+using namespace rive;
+
+TEST_CASE("butt capped line extrudes to a quad", "[stroke]")
+{
+    RawPath path;
+    path.moveTo(0.0f, 0.0f);
+    path.lineTo(100.0f, 0.0f);
+    SegmentedContour contour(1.0f);
+    contour.contour(path, Mat2D(), 1.0f);
+
+    ContourStroke stroke;
+    stroke.extrude(&contour, false, StrokeJoin::miter, StrokeCap::butt, 5.0f);
+    const std::vector<Vec2D>& strip = stroke.triangleStrip();
+    REQUIRE(strip.size() == 4);
+    CHECK(strip[0] == Vec2D(0.0f, 5.0f));
+    CHECK(strip[1] == Vec2D(0.0f, -5.0f));
+    CHECK(strip[2] == Vec2D(100.0f, 5.0f));
+    CHECK(strip[3] == Vec2D(100.0f, -5.0f));
+}
+
+TEST_CASE("round caps and joins stay on the stroke radius", "[stroke]")
+{
+    RawPath path;
+    path.moveTo(0.0f, 0.0f);
+    path.lineTo(100.0f, 0.0f);
+    path.lineTo(100.0f, 100.0f);
+    SegmentedContour contour(1.0f);
+    contour.contour(path, Mat2D(), 1.0f);
+
+    const float strokeWidth = 20.0f;
+    ContourStroke stroke;
+    stroke.extrude(&contour, false, StrokeJoin::round, StrokeCap::round, strokeWidth);
+    const std::vector<Vec2D>& strip = stroke.triangleStrip();
+    REQUIRE(strip.size() > 8);
+
+    // Every vertex is either a contour point (cap/join pivot) or within the
+    // stroke radius of one (allowing for the miter of the inner corner).
+    Vec2D points[] = {Vec2D(0.0f, 0.0f), Vec2D(100.0f, 0.0f), Vec2D(100.0f, 100.0f)};
+    size_t onRadius = 0;
+    for (auto vertex : strip)
+    {
+        float closest = std::numeric_limits<float>::max();
+        for (auto point : points)
+        {
+            closest = std::min(closest, Vec2D::distance(vertex, point));
+        }
+        CHECK(closest <= strokeWidth * math::SQRT2 + 0.01f);
+        if (std::abs(closest - strokeWidth) < 0.05f)
+        {
+            onRadius++;
+        }
+    }
+    // Caps and the join generate plenty of arc vertices.
+    CHECK(onRadius > 20);
+}
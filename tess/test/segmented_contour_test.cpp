@@ -0,0 +1,84 @@
+#include <catch.hpp>
+#include "rive/math/raw_path.hpp"
+#include "rive/tess/segmented_contour.hpp"
+#include <limits>
+
+using namespace rive;
+
+static RawPath makeArc()
+{
+    RawPath path;
+    path.moveTo(0.0f, 0.0f);
+    path.cubicTo(0.0f, 55.0f, 45.0f, 100.0f, 100.0f, 100.0f);
+    return path;
+}
+
+TEST_CASE("cubics are flattened for the device scale", "[contour]")
+{
+    RawPath path = makeArc();
+    Mat2D identity;
+
+    SegmentedContour contour(1.0f);
+    contour.contour(path, identity, 1.0f);
+    auto defaultCount = contour.contourSize();
+    REQUIRE(defaultCount > 2);
+
+    // Zoomed out content needs fewer vertices.
+    contour.contour(path, identity, 0.125f);
+    auto zoomedOutCount = contour.contourSize();
+    REQUIRE(zoomedOutCount < defaultCount);
+    REQUIRE(zoomedOutCount >= 2);
+
+    // Zoomed in content gets more.
+    contour.contour(path, identity, 8.0f);
+    auto zoomedInCount = contour.contourSize();
+    REQUIRE(zoomedInCount > defaultCount);
+}
+
+TEST_CASE("flattened cubics stay on the curve", "[contour]")
+{
+    RawPath path = makeArc();
+    SegmentedContour contour(1.0f);
+    contour.contour(path, Mat2D(), 1.0f);
+
+    auto points = contour.contourPoints();
+    REQUIRE(points.front() == Vec2D(0.0f, 0.0f));
+    // The final point lands exactly on the end of the cubic.
+    REQUIRE(points.back() == Vec2D(100.0f, 100.0f));
+
+    // Every point is within the curve's hull and in order along it.
+    for (size_t i = 1; i < points.size(); i++)
+    {
+        CHECK(points[i].x >= points[i - 1].x - 1e-3f);
+        CHECK(points[i].y >= points[i - 1].y - 1e-3f);
+    }
+
+    const AABB& bounds = contour.bounds();
+    CHECK(bounds.minX == Approx(0.0f));
+    CHECK(bounds.minY == Approx(0.0f));
+    CHECK(bounds.maxX == Approx(100.0f));
+    CHECK(bounds.maxY == Approx(100.0f));
+}
+
+TEST_CASE("transform is applied before flattening", "[contour]")
+{
+    RawPath path = makeArc();
+    SegmentedContour contour(1.0f);
+    contour.contour(path, Mat2D::fromTranslate(10.0f, 20.0f), 1.0f);
+
+    auto points = contour.contourPoints();
+    REQUIRE(points.front() == Vec2D(10.0f, 20.0f));
+    REQUIRE(points.back() == Vec2D(110.0f, 120.0f));
+}
+
+TEST_CASE("non-finite cubics flatten to a single segment", "[contour]")
+{
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    RawPath path;
+    path.moveTo(0.0f, 0.0f);
+    path.cubicTo(nan, 55.0f, 45.0f, nan, 100.0f, 100.0f);
+    SegmentedContour contour(1.0f);
+    contour.contour(path, Mat2D(), 1.0f);
+    // The move plus the cubic's end point.
+    CHECK(contour.contourSize() == 2);
+}
@@ -18,6 +18,12 @@ protected:
     }
 
     void setTriangulatedBounds(const rive::AABB& value) override {}
+
+    void resetTriangles() override
+    {
+        vertices.clear();
+        indices.clear();
+    }
 };
 
 TEST_CASE("simple triangle path triangulates as expected", "[file]")
@@ -40,4 +46,68 @@ TEST_CASE("simple triangle path triangulates as expected", "[file]")
     REQUIRE(shapeRenderPath.indices[0] == 2);
     REQUIRE(shapeRenderPath.indices[1] == 0);
     REQUIRE(shapeRenderPath.indices[2] == 1);
-}
\ No newline at end of file
+}
+
+TEST_CASE("unchanged geometry reuses its triangulation", "[file]")
+{
+    auto file = ReadRiveFile("../test/assets/triangle.riv");
+    auto artboard = file->artboard();
+    artboard->advance(0.0f);
+
+    auto path = artboard->find<rive::Path>("triangle_path");
+    REQUIRE(path != nullptr);
+    TestRenderPath renderPath;
+    path->buildPath(renderPath);
+
+    rive::Mat2D identity;
+    TestRenderPath shapeRenderPath;
+    shapeRenderPath.addRenderPath(&renderPath, identity);
+    REQUIRE(shapeRenderPath.triangulate());
+    auto vertices = shapeRenderPath.vertices;
+    auto indices = shapeRenderPath.indices;
+
+    // Rebuilding the container with the same sub-path and transform keeps
+    // the existing triangles.
+    shapeRenderPath.rewind();
+    shapeRenderPath.addRenderPath(&renderPath, identity);
+    REQUIRE(!shapeRenderPath.triangulate());
+    REQUIRE(shapeRenderPath.vertices == vertices);
+    REQUIRE(shapeRenderPath.indices == indices);
+    REQUIRE(shapeRenderPath.triangulationTransform() == identity);
+
+    // Moving the whole path reuses the triangles under a transform.
+    auto translation = rive::Mat2D::fromTranslate(20.0f, -5.0f);
+    shapeRenderPath.rewind();
+    shapeRenderPath.addRenderPath(&renderPath, translation);
+    REQUIRE(!shapeRenderPath.triangulate());
+    REQUIRE(shapeRenderPath.vertices == vertices);
+    REQUIRE(shapeRenderPath.triangulationTransform() == translation);
+
+    // Scaled down the triangles are still fine enough.
+    auto smaller = rive::Mat2D::fromScale(0.5f, 0.5f);
+    shapeRenderPath.rewind();
+    shapeRenderPath.addRenderPath(&renderPath, smaller);
+    REQUIRE(!shapeRenderPath.triangulate());
+    REQUIRE(shapeRenderPath.triangulationTransform() == smaller);
+
+    // Scaled up they'd be too coarse, the path is flattened again.
+    shapeRenderPath.rewind();
+    shapeRenderPath.addRenderPath(&renderPath, rive::Mat2D::fromScale(2.0f, 2.0f));
+    REQUIRE(shapeRenderPath.triangulate());
+    REQUIRE(shapeRenderPath.triangulationTransform() == identity);
+
+    // A non-uniform scale can't be reused (gradients wouldn't map).
+    shapeRenderPath.rewind();
+    shapeRenderPath.addRenderPath(&renderPath, rive::Mat2D::fromScale(2.0f, 1.0f));
+    REQUIRE(shapeRenderPath.triangulate());
+    REQUIRE(shapeRenderPath.triangulationTransform() == identity);
+
+    // Changing the sub-path's geometry forces a new triangulation.
+    renderPath.rewind();
+    path->buildPath(renderPath);
+    shapeRenderPath.rewind();
+    shapeRenderPath.addRenderPath(&renderPath, identity);
+    REQUIRE(shapeRenderPath.triangulate());
+    REQUIRE(shapeRenderPath.vertices == vertices);
+    REQUIRE(shapeRenderPath.indices == indices);
+}
@@ -2,11 +2,16 @@
 #include "rive/audio/audio_source.hpp"
 #include "rive/audio/audio_sound.hpp"
 #include "rive/audio/audio_reader.hpp"
+#include "rive/audio/offline_audio_renderer.hpp"
+#include "rive/animation/state_machine_instance.hpp"
+#include "rive/scene.hpp"
 #include "rive/audio_event.hpp"
 #include "rive/assets/audio_asset.hpp"
 #include "rive_file_reader.hpp"
 #include "catch.hpp"
+#include <atomic>
 #include <string>
+#include <thread>
 
 using namespace rive;
 
@@ -76,6 +81,115 @@ TEST_CASE("audio source can be opened", "[audio]")
     REQUIRE(engine->level(1) != 0);
 }
 
+TEST_CASE("short audio clips are decoded once and voices are recycled", "[audio]")
+{
+    rcp<AudioEngine> engine = AudioEngine::Make(2, 44100);
+    REQUIRE(engine != nullptr);
+    auto file = loadFile("../../test/assets/audio/what.wav");
+    auto span = Span<uint8_t>(file);
+    rcp<AudioSource> audioSource = rcp<AudioSource>(new AudioSource(span));
+    REQUIRE(engine->freeVoiceCount() == AudioEngine::defaultVoicePoolSize);
+
+    auto sound = engine->play(audioSource, 0, 0, 0);
+    REQUIRE(sound != nullptr);
+    REQUIRE(engine->decodeCacheCount() == 1);
+    // The clip is already at the engine's sample rate, so it decodes to its
+    // own length in the engine's channels.
+    REQUIRE(audioSource->sampleRate() == engine->sampleRate());
+    const uint64_t clipFrames = audioSource->lengthInFrames();
+    const size_t clipBytes = clipFrames * engine->channels() * sizeof(float);
+    REQUIRE(engine->decodeCacheBytes() == clipBytes);
+    REQUIRE(engine->freeVoiceCount() == AudioEngine::defaultVoicePoolSize - 1);
+    sound = nullptr;
+
+    // Play the clip to the end.
+    float frames[1024 * 2] = {};
+    for (uint64_t played = 0; played <= clipFrames; played += 1024)
+    {
+        engine->readAudioFrames(frames, 1024);
+    }
+    engine->pump();
+    REQUIRE(engine->playingSoundCount() == 0);
+
+    // The finished voice goes back to the pool and the decoded clip is reused.
+    sound = engine->play(audioSource, 0, 0, 0);
+    REQUIRE(sound != nullptr);
+    REQUIRE(engine->decodeCacheCount() == 1);
+    REQUIRE(engine->decodeCacheBytes() == clipBytes);
+    REQUIRE(engine->freeVoiceCount() == AudioEngine::defaultVoicePoolSize - 1);
+
+    // Only room for one clip, the least recently used one gets evicted.
+    engine->decodeCacheLimits(AudioEngine::defaultMaxCachedClipBytes, clipBytes);
+    rcp<AudioSource> otherSource = rcp<AudioSource>(new AudioSource(span));
+    REQUIRE(engine->play(otherSource, 0, 0, 0) != nullptr);
+    REQUIRE(engine->decodeCacheCount() == 1);
+    REQUIRE(engine->decodeCacheBytes() == clipBytes);
+
+    // Disabling the cache falls back to streaming from the decoder.
+    engine->decodeCacheLimits(0, 0);
+    REQUIRE(engine->decodeCacheCount() == 0);
+    REQUIRE(engine->play(audioSource, 0, 0, 0) != nullptr);
+    REQUIRE(engine->decodeCacheCount() == 0);
+    engine->readAudioFrames(frames, 1024);
+}
+
+TEST_CASE("completed sounds are released by pump", "[audio]")
+{
+    rcp<AudioEngine> engine = AudioEngine::Make(2, 44100);
+    REQUIRE(engine != nullptr);
+    auto file = loadFile("../../test/assets/audio/what.wav");
+    auto span = Span<uint8_t>(file);
+    rcp<AudioSource> audioSource = rcp<AudioSource>(new AudioSource(span));
+
+    // More sounds than the completion queue holds, so some of them have to be
+    // found by pump after the queue overflows.
+    const int soundCount = 3000;
+    float frames[512 * 2] = {};
+    for (int i = 0; i < soundCount; i++)
+    {
+        REQUIRE(engine->play(audioSource, 0, 128, 0) != nullptr);
+        if (i % 1500 == 1499)
+        {
+            engine->readAudioFrames(frames, 512);
+        }
+    }
+    engine->readAudioFrames(frames, 512);
+    engine->pump();
+    REQUIRE(engine->playingSoundCount() == 0);
+    REQUIRE(engine->freeVoiceCount() == AudioEngine::defaultVoicePoolSize);
+}
+
+TEST_CASE("sounds can be played while another thread reads frames", "[audio]")
+{
+    rcp<AudioEngine> engine = AudioEngine::Make(2, 44100);
+    REQUIRE(engine != nullptr);
+    auto file = loadFile("../../test/assets/audio/what.wav");
+    auto span = Span<uint8_t>(file);
+    rcp<AudioSource> audioSource = rcp<AudioSource>(new AudioSource(span));
+
+    std::atomic<bool> done(false);
+    std::thread audioThread([&]() {
+        float frames[256 * 2];
+        while (!done.load())
+        {
+            engine->readAudioFrames(frames, 256);
+        }
+    });
+
+    for (int i = 0; i < 5000; i++)
+    {
+        engine->play(audioSource, 0, 64 + i % 256, 0);
+        engine->pump();
+    }
+    done.store(true);
+    audioThread.join();
+
+    float frames[512 * 2] = {};
+    engine->readAudioFrames(frames, 512);
+    engine->pump();
+    REQUIRE(engine->playingSoundCount() == 0);
+}
+
 TEST_CASE("file with audio loads correctly", "[text]")
 {
     auto file = ReadRiveFile("../../test/assets/sound.riv");
@@ -230,4 +344,63 @@ TEST_CASE("Artboard does not have audio", "[audio]")
     REQUIRE(artboard->hasAudio() == false);
 }
 
-// TODO check if sound->stop calls completed callback!!!
\ No newline at end of file
+TEST_CASE("offline audio rendering matches the frame rate", "[audio]")
+{
+    auto file = ReadRiveFile("../../test/assets/sound.riv");
+
+    // 44100 isn't a multiple of 24, frames alternate between 1837 and 1838
+    // samples without drifting.
+    auto artboard = file->artboardDefault();
+    auto scene = artboard->defaultScene();
+    REQUIRE(scene != nullptr);
+    rcp<AudioEngine> engine = AudioEngine::Make(2, 44100);
+    OfflineAudioRenderer renderer(scene.get(), engine, 24.0);
+    uint64_t total = 0;
+    for (int i = 0; i < 48; i++)
+    {
+        uint64_t count = renderer.nextAudioFrameCount();
+        REQUIRE((count == 1837 || count == 1838));
+        total += count;
+        std::vector<float> samples(count * 2);
+        REQUIRE(renderer.advance(samples) == count);
+    }
+    REQUIRE(total == 44100 * 2);
+    REQUIRE(renderer.frame() == 48);
+
+    // Too small a buffer doesn't advance.
+    std::vector<float> tooSmall(16);
+    REQUIRE(renderer.advance(tooSmall) == 0);
+    REQUIRE(renderer.frame() == 48);
+}
+
+TEST_CASE("offline audio rendering is deterministic", "[audio]")
+{
+    auto file = ReadRiveFile("../../test/assets/sound.riv");
+
+    std::vector<float> renders[2];
+    for (auto& samples : renders)
+    {
+        auto artboard = file->artboardDefault();
+        auto machine = artboard->defaultStateMachine();
+        REQUIRE(machine != nullptr);
+        // Random transitions must play out the same way in both renders.
+        machine->seedRandom(1234);
+        rcp<AudioEngine> engine = AudioEngine::Make(2, 48000);
+        OfflineAudioRenderer renderer(machine.get(), engine, 60.0);
+        // Start the sound so the render can't pass by being silent.
+        auto audioEvents = artboard->find<AudioEvent>();
+        REQUIRE(audioEvents.size() == 1);
+        audioEvents[0]->play();
+        renderer.render(120, samples);
+        REQUIRE(samples.size() == 48000 * 2 * 2);
+    }
+    double energy = 0.0;
+    for (float sample : renders[0])
+    {
+        energy += (double)sample * sample;
+    }
+    REQUIRE(energy > 0.0);
+    REQUIRE(renders[0] == renders[1]);
+}
+
+// TODO check if sound->stop calls completed callback!!!
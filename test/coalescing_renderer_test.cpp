@@ -0,0 +1,139 @@
+#include <catch.hpp>
+#include <rive/artboard.hpp>
+#include <rive/coalescing_renderer.hpp>
+#include <rive/file.hpp>
+#include <software_renderer.hpp>
+#include "rive_file_reader.hpp"
+
+using namespace rive;
+
+namespace
+{
+// Tracks the backend's save depth.
+class DepthRenderer : public Renderer
+{
+public:
+    int depth = 0;
+    int maxDepth = 0;
+    int clips = 0;
+    int draws = 0;
+
+    void save() override { maxDepth = std::max(maxDepth, ++depth); }
+    void restore() override { depth--; }
+    void transform(const Mat2D&) override {}
+    void drawPath(RenderPath*, RenderPaint*) override { draws++; }
+    void clipPath(RenderPath*) override { clips++; }
+    void drawImage(const RenderImage*, BlendMode, float) override { draws++; }
+    void drawImageMesh(const RenderImage*,
+                       rcp<RenderBuffer>,
+                       rcp<RenderBuffer>,
+                       rcp<RenderBuffer>,
+                       uint32_t,
+                       uint32_t,
+                       BlendMode,
+                       float) override
+    {
+        draws++;
+    }
+};
+} // namespace
+
+TEST_CASE("coalescing renderer elides shared clips and transforms", "[coalescing]")
+{
+    Factory* factory = &gNoOpFactory;
+    auto clip = factory->makeEmptyRenderPath();
+    auto path = factory->makeEmptyRenderPath();
+    auto paint = factory->makeRenderPaint();
+
+    DepthRenderer backend;
+    {
+        CoalescingRenderer renderer(&backend);
+        renderer.save();
+        for (int i = 0; i < 10; i++)
+        {
+            // Ten drawables, same clip, each with a fill and a stroke.
+            renderer.save();
+            renderer.clipPath(clip.get());
+            for (int paintIndex = 0; paintIndex < 2; paintIndex++)
+            {
+                renderer.save();
+                renderer.transform(Mat2D::fromTranslate((float)i + 1.0f, 0.0f));
+                renderer.drawPath(path.get(), paint.get());
+                renderer.restore();
+            }
+            renderer.restore();
+        }
+        renderer.restore();
+
+        CHECK(backend.depth == 0);
+        CHECK(backend.draws == 20);
+        CHECK(backend.clips == 1);
+        const auto& counters = renderer.counters();
+        CHECK(counters.clipPath.received == 10);
+        CHECK(counters.clipPath.forwarded == 1);
+        CHECK(counters.clipPath.elided() == 9);
+        CHECK(counters.transform.received == 20);
+        CHECK(counters.transform.forwarded == 10);
+        CHECK(counters.save.forwarded == counters.restore.forwarded);
+        CHECK(counters.draws == 20);
+    }
+    CHECK(backend.depth == 0);
+}
+
+TEST_CASE("coalescing renderer drops clips that changed", "[coalescing]")
+{
+    Factory* factory = &gNoOpFactory;
+    auto clipA = factory->makeEmptyRenderPath();
+    auto clipB = factory->makeEmptyRenderPath();
+    auto path = factory->makeEmptyRenderPath();
+    auto paint = factory->makeRenderPaint();
+
+    DepthRenderer backend;
+    CoalescingRenderer renderer(&backend);
+    renderer.save();
+    renderer.clipPath(clipA.get());
+    renderer.drawPath(path.get(), paint.get());
+    renderer.save();
+    renderer.clipPath(clipB.get());
+    renderer.drawPath(path.get(), paint.get());
+    renderer.restore();
+    renderer.drawPath(path.get(), paint.get());
+    // Nothing was drawn with this transform so it never reaches the backend.
+    renderer.transform(Mat2D::fromScale(2.0f, 2.0f));
+    renderer.restore();
+
+    CHECK(backend.clips == 2);
+    CHECK(backend.draws == 3);
+    CHECK(backend.depth == 0);
+    CHECK(renderer.counters().transform.forwarded == 0);
+}
+
+TEST_CASE("coalescing renderer output matches the backend", "[coalescing]")
+{
+    SoftwareFactory factory;
+    auto file = ReadRiveFile("../../test/assets/circle_clips.riv", &factory);
+    auto artboard = file->artboardDefault();
+    artboard->advance(0.0f);
+
+    SoftwareRenderer direct(200, 200);
+    SoftwareRenderer coalesced(200, 200);
+    CoalescingRenderer coalescing(&coalesced);
+    for (Renderer* renderer : {(Renderer*)&direct, (Renderer*)&coalescing})
+    {
+        renderer->save();
+        renderer->align(Fit::contain,
+                        Alignment::center,
+                        AABB(0.0f, 0.0f, 200.0f, 200.0f),
+                        artboard->bounds());
+        artboard->draw(renderer);
+        renderer->restore();
+    }
+    direct.flush();
+    coalesced.flush();
+
+    CHECK(std::equal(direct.pixels(), direct.pixels() + 200 * 200 * 4, coalesced.pixels()));
+    const auto& counters = coalescing.counters();
+    CHECK(counters.draws > 0);
+    CHECK(counters.clipPath.forwarded <= counters.clipPath.received);
+    CHECK(counters.save.forwarded == counters.restore.forwarded);
+}
@@ -0,0 +1,60 @@
+#include <catch.hpp>
+#include <rive/artboard.hpp>
+#include <rive/file.hpp>
+#include <rive/animation/linear_animation.hpp>
+#include <rive/assets/image_asset.hpp>
+#include <rive/generated/core_registry.hpp>
+#include <rive/shapes/path.hpp>
+#include <rive/shapes/shape.hpp>
+#include "rive_file_reader.hpp"
+
+using namespace rive;
+
+TEST_CASE("core objects report their type name", "[cost]")
+{
+    CHECK(std::string(CoreRegistry::objectName(Shape::typeKey)) == "Shape");
+    CHECK(std::string(CoreRegistry::objectName(ImageAsset::typeKey)) == "ImageAsset");
+    CHECK(CoreRegistry::objectName(-1) == nullptr);
+}
+
+TEST_CASE("animations count their keyframes", "[cost]")
+{
+    auto file = ReadRiveFile("../../test/assets/juice.riv");
+    auto artboard = file->artboardDefault();
+    REQUIRE(artboard->animationCount() > 0);
+    auto walk = artboard->animation("walk");
+    REQUIRE(walk != nullptr);
+    CHECK(walk->keyFrameCount() == 235);
+    auto blend = artboard->animation("orange_red");
+    REQUIRE(blend != nullptr);
+    CHECK(blend->keyFrameCount() == 4);
+}
+
+TEST_CASE("paths count their vertices", "[cost]")
+{
+    auto file = ReadRiveFile("../../test/assets/juice.riv");
+    auto artboard = file->artboardDefault();
+    artboard->advance(0.0f);
+    size_t vertices = 0;
+    for (auto path : artboard->find<Path>())
+    {
+        vertices += path->vertexCount();
+    }
+    CHECK(vertices == 116);
+}
+
+TEST_CASE("file assets know their embedded size", "[cost]")
+{
+    auto file = ReadRiveFile("../../test/assets/walle.riv");
+    auto assets = file->assets();
+    REQUIRE(assets.size() == 2);
+    CHECK(assets[0]->embeddedSize() == 218873);
+    CHECK(assets[1]->embeddedSize() == 246825);
+
+    // Out of band assets embed nothing.
+    auto hosted = ReadRiveFile("../../test/assets/hosted_image_file.riv");
+    for (auto asset : hosted->assets())
+    {
+        CHECK(asset->embeddedSize() == 0);
+    }
+}
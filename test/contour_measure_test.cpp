@@ -143,6 +143,27 @@ TEST_CASE("contour-oval", "[contourmeasure]")
     REQUIRE(!iter.next());
 }
 
+TEST_CASE("contour-cursor", "[contourmeasure]")
+{
+    RawPath path;
+    path.addOval({-10, -10, 10, 10}, PathDirection::cw);
+    ContourMeasureIter iter(&path);
+    auto cm = iter.next();
+    REQUIRE(cm != nullptr);
+
+    // Lookups through a cursor match plain lookups, walking forwards, jumping
+    // backwards and going past either end.
+    const float distances[] = {-5.0f, 0.0f, 0.1f, 0.2f, 3.0f, 3.1f, 40.0f, 1.0f, 62.0f, 100.0f};
+    size_t cursor = 0;
+    for (float d : distances)
+    {
+        auto expected = cm->getPosTan(d);
+        auto actual = cm->getPosTan(d, &cursor);
+        REQUIRE(actual.pos == expected.pos);
+        REQUIRE(actual.tan == expected.tan);
+    }
+}
+
 TEST_CASE("bad contour", "[contourmeasure]")
 {
     auto file = ReadRiveFile("../../test/assets/zombie_skins.riv");
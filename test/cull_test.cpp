@@ -0,0 +1,72 @@
+#include <rive/file.hpp>
+#include <rive/shapes/clipping_shape.hpp>
+#include <rive/shapes/shape.hpp>
+#include <utils/no_op_renderer.hpp>
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+
+class CountingRenderer : public rive::NoOpRenderer
+{
+public:
+    int drawCount = 0;
+    void drawPath(rive::RenderPath* path, rive::RenderPaint* paint) override { drawCount++; }
+};
+
+static int countDraws(rive::Artboard* artboard,
+                      rive::Artboard::DrawOption option = rive::Artboard::DrawOption::kNormal)
+{
+    CountingRenderer renderer;
+    artboard->draw(&renderer, option);
+    return renderer.drawCount;
+}
+
+TEST_CASE("drawables outside the viewport are culled", "[culling]")
+{
+    auto file = ReadRiveFile("../../test/assets/juice.riv");
+    auto artboard = file->artboardDefault();
+    artboard->advance(0.0f);
+
+    int allDraws = countDraws(artboard.get());
+    int backgroundDraws = countDraws(artboard.get(), rive::Artboard::DrawOption::kHideFG);
+    REQUIRE(allDraws > backgroundDraws);
+
+    artboard->viewport(rive::AABB(-1e6f, -1e6f, 1e6f, 1e6f));
+    REQUIRE(countDraws(artboard.get()) == allDraws);
+
+    // The background is always drawn, everything else is off screen.
+    artboard->viewport(rive::AABB(-1e6f, -1e6f, -1e6f + 10.0f, -1e6f + 10.0f));
+    REQUIRE(countDraws(artboard.get()) == backgroundDraws);
+
+    // Only the feet visible: the background, both shins and the shadow draw,
+    // the other 16 paths are culled.
+    REQUIRE(allDraws == 20);
+    artboard->viewport(rive::AABB(500.0f, 745.0f, 600.0f, 775.0f));
+    REQUIRE(countDraws(artboard.get()) == 4);
+
+    artboard->clearViewport();
+    REQUIRE(countDraws(artboard.get()) == allDraws);
+}
+
+TEST_CASE("drawables are culled by their clipping shapes", "[culling]")
+{
+    auto file = ReadRiveFile("../../test/assets/circle_clips.riv");
+    auto artboard = file->artboardDefault();
+    artboard->advance(0.0f);
+
+    auto shape = artboard->find<rive::Shape>("TopEllipse");
+    REQUIRE(shape != nullptr);
+    REQUIRE(shape->clippingShapes().size() == 2);
+
+    rive::AABB shapeBounds;
+    REQUIRE(shape->drawBounds(&shapeBounds));
+    REQUIRE(!shape->isOutside(shapeBounds));
+
+    rive::AABB clipBounds;
+    REQUIRE(shape->clippingShapes()[1]->worldBounds(&clipBounds));
+    // Just right of the clip, the shape can't draw there.
+    rive::AABB pastClip(clipBounds.maxX + 1.0f,
+                        clipBounds.minY,
+                        clipBounds.maxX + 2.0f,
+                        clipBounds.maxY);
+    REQUIRE(shape->isOutside(pastClip));
+}
@@ -0,0 +1,84 @@
+#include <catch.hpp>
+#include <rive/dependency_sorter.hpp>
+#include <rive/node.hpp>
+#include <algorithm>
+#include <memory>
+
+using namespace rive;
+
+static size_t indexOf(const std::vector<Component*>& order, Component* component)
+{
+    return std::find(order.begin(), order.end(), component) - order.begin();
+}
+
+TEST_CASE("dependency sorter orders components before their dependents", "[dependency]")
+{
+    std::vector<std::unique_ptr<Node>> nodes;
+    for (int i = 0; i < 6; i++)
+    {
+        nodes.emplace_back(new Node());
+    }
+    // 0 -> 1 -> 3, 0 -> 2 -> 3 -> 4, 2 -> 5
+    nodes[0]->addDependent(nodes[1].get());
+    nodes[0]->addDependent(nodes[2].get());
+    nodes[1]->addDependent(nodes[3].get());
+    nodes[2]->addDependent(nodes[3].get());
+    nodes[3]->addDependent(nodes[4].get());
+    nodes[2]->addDependent(nodes[5].get());
+
+    DependencySorter sorter;
+    std::vector<Component*> order;
+    REQUIRE(sorter.sort(nodes[0].get(), order));
+    REQUIRE(order.size() == 6);
+    REQUIRE(order[0] == nodes[0].get());
+    for (auto& node : nodes)
+    {
+        for (auto dependent : node->dependents())
+        {
+            CHECK(indexOf(order, node.get()) < indexOf(order, dependent));
+        }
+    }
+
+    // The same sorter can be reused, including on a subgraph whose
+    // components still carry slots from the previous sort.
+    REQUIRE(sorter.sort(nodes[2].get(), order));
+    REQUIRE(order.size() == 4);
+    CHECK(order[0] == nodes[2].get());
+    CHECK(indexOf(order, nodes[3].get()) < indexOf(order, nodes[4].get()));
+}
+
+TEST_CASE("dependency sorter handles long chains", "[dependency]")
+{
+    // Deep enough to overflow the stack with a recursive sort.
+    const int count = 200000;
+    std::vector<std::unique_ptr<Node>> nodes;
+    for (int i = 0; i < count; i++)
+    {
+        nodes.emplace_back(new Node());
+        if (i > 0)
+        {
+            nodes[i - 1]->addDependent(nodes[i].get());
+        }
+    }
+
+    DependencySorter sorter;
+    std::vector<Component*> order;
+    REQUIRE(sorter.sort(nodes[0].get(), order));
+    REQUIRE(order.size() == count);
+    for (int i = 0; i < count; i++)
+    {
+        REQUIRE(order[i] == nodes[i].get());
+    }
+}
+
+TEST_CASE("dependency sorter reports cycles", "[dependency]")
+{
+    Node a, b, c;
+    a.addDependent(&b);
+    b.addDependent(&c);
+    c.addDependent(&a);
+
+    DependencySorter sorter;
+    std::vector<Component*> order;
+    CHECK(!sorter.sort(&a, order));
+}
@@ -37,3 +37,39 @@ TEST_CASE("draw rules load and sort correctly", "[draw rules]")
         artboard->draw(&renderer);
     }
 }
+
+TEST_CASE("drawables are stamped with their draw order index", "[draw rules]")
+{
+    auto file = ReadRiveFile("../../test/assets/draw_rule_cycle.riv");
+
+    std::unique_ptr<rive::ArtboardInstance> artboard = file->artboardDefault();
+    std::unique_ptr<rive::LinearAnimationInstance> animation = artboard->animationAt(0);
+    for (int i = 0; i < 10; i++)
+    {
+        animation->advanceAndApply(0.5f);
+
+        std::vector<rive::Drawable*> drawables;
+        for (auto object : artboard->objects())
+        {
+            if (object != nullptr && object->is<rive::Drawable>())
+            {
+                drawables.push_back(object->as<rive::Drawable>());
+            }
+        }
+        REQUIRE(!drawables.empty());
+
+        // Indices form a permutation of [0, count).
+        std::vector<bool> seen(drawables.size(), false);
+        for (auto drawable : drawables)
+        {
+            auto index = drawable->drawOrderIndex();
+            REQUIRE(index < drawables.size());
+            REQUIRE(!seen[index]);
+            seen[index] = true;
+        }
+
+        // The first drawable in the artboard's list draws last (on top).
+        REQUIRE(artboard->firstDrawable() != nullptr);
+        REQUIRE(artboard->firstDrawable()->drawOrderIndex() == drawables.size() - 1);
+    }
+}
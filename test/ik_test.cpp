@@ -1,5 +1,7 @@
 #include <rive/node.hpp>
 #include <rive/bones/bone.hpp>
+#include <rive/constraints/fabrik_solver.hpp>
+#include <rive/constraints/ik_constraint.hpp>
 #include <rive/shapes/shape.hpp>
 #include <utils/no_op_renderer.hpp>
 #include "rive_file_reader.hpp"
@@ -153,4 +155,63 @@ TEST_CASE("ik keeps working after a lot of iterations", "[file]")
                                        240.1275634765625f,
                                        225.07647705078125f)));
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("fabrik solver reaches targets with long chains", "[ik]")
+{
+    rive::FabrikSolver solver;
+    solver.resize(9);
+    for (size_t i = 0; i < 9; i++)
+    {
+        solver.joint(i, rive::Vec2D(i * 10.0f, 0.0f));
+    }
+    solver.measure();
+
+    // Reachable target, the tip gets there within the budget and bone
+    // lengths are preserved.
+    rive::Vec2D target(30.0f, 40.0f);
+    int iterations = solver.solve(target, 50, 0.01f);
+    REQUIRE(iterations > 0);
+    REQUIRE(iterations <= 50);
+    REQUIRE(rive::Vec2D::distance(solver.joint(8), target) <= 0.01f);
+    REQUIRE(solver.joint(0) == rive::Vec2D(0.0f, 0.0f));
+    for (size_t i = 0; i < 8; i++)
+    {
+        REQUIRE(rive::Vec2D::distance(solver.joint(i), solver.joint(i + 1)) ==
+                Approx(10.0f).margin(0.001f));
+    }
+
+    // Already at the target, nothing to do.
+    REQUIRE(solver.solve(target, 50, 0.01f) == 0);
+
+    // Out of reach, the chain points straight at the target.
+    solver.solve(rive::Vec2D(0.0f, -200.0f), 50, 0.01f);
+    REQUIRE(solver.joint(8).x == Approx(0.0f).margin(0.001f));
+    REQUIRE(solver.joint(8).y == Approx(-80.0f).margin(0.001f));
+}
+
+TEST_CASE("fabrik ik solver matches the analytic two bone solve", "[ik]")
+{
+    auto file = ReadRiveFile("../../test/assets/two_bone_ik.riv");
+    auto artboard = file->artboard();
+    auto boneB = artboard->find<rive::Bone>("b");
+    REQUIRE(boneB != nullptr);
+    REQUIRE(boneB->constraints().size() == 1);
+    REQUIRE(boneB->constraints()[0]->is<rive::IKConstraint>());
+    auto ik = boneB->constraints()[0]->as<rive::IKConstraint>();
+    auto animation = artboard->animation("Animation 1");
+    REQUIRE(animation != nullptr);
+
+    for (float time : {0.0f, 1.0f})
+    {
+        ik->solver(rive::IKConstraint::Solver::kAnalytic);
+        animation->apply(artboard, time, 1.0f);
+        artboard->advance(0.0f);
+        auto analyticTip = boneB->tipWorldTranslation();
+
+        ik->solver(rive::IKConstraint::Solver::kFabrik);
+        ik->solverBudget(20, 0.001f);
+        artboard->advance(0.0f);
+        REQUIRE(rive::Vec2D::distance(boneB->tipWorldTranslation(), analyticTip) < 0.1f);
+    }
+}
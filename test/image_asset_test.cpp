@@ -7,6 +7,7 @@
 #include <rive/relative_local_asset_loader.hpp>
 #include <utils/no_op_factory.hpp>
 #include <utils/no_op_renderer.hpp>
+#include <software_renderer.hpp>
 #include "rive_file_reader.hpp"
 #include <catch.hpp>
 #include <cstdio>
@@ -77,3 +78,115 @@ TEST_CASE("out of band image assets loads correctly", "[assets]")
     rive::NoOpRenderer renderer;
     file->artboard()->draw(&renderer);
 }
+
+TEST_CASE("image headers probe without decoding", "[assets]")
+{
+    rive::ImageHeader header;
+    auto png = ReadFile("../../test/assets/placeholder.png");
+    REQUIRE(rive::ImageHeader::probe(png, &header));
+    CHECK(header.format == rive::ImageHeader::Format::png);
+    CHECK(header.width == 226);
+    CHECK(header.height == 128);
+    CHECK(header.decodedByteSize() == 226 * 128 * 4);
+
+    auto jpeg = ReadFile("../../test/assets/open_source.jpg");
+    REQUIRE(rive::ImageHeader::probe(jpeg, &header));
+    CHECK(header.format == rive::ImageHeader::Format::jpeg);
+    CHECK(header.width == 350);
+    CHECK(header.height == 200);
+    CHECK(!header.hasAlpha);
+
+    // Truncated before the dimensions, or not an image at all.
+    CHECK(!rive::ImageHeader::probe(rive::Span<const uint8_t>(png.data(), 20), &header));
+    CHECK(!header.valid());
+    CHECK(!rive::ImageHeader::probe(rive::Span<const uint8_t>(jpeg.data(), 40), &header));
+    uint8_t garbage[32] = {};
+    CHECK(!rive::ImageHeader::probe(rive::Span<const uint8_t>(garbage, sizeof(garbage)), &header));
+}
+
+TEST_CASE("image budgets downsample and defer images", "[assets]")
+{
+    rive::SoftwareFactory factory;
+    auto bytes = ReadFile("../../test/assets/walle.riv");
+
+    auto file = rive::File::import(bytes, &factory);
+    REQUIRE(file != nullptr);
+    size_t estimate = file->imageMemoryEstimate();
+    CHECK(estimate > 0);
+    CHECK(file->decodedImageMemory() == estimate);
+
+    // Half the memory, images that don't fit are downsampled.
+    rive::ImageBudget budget;
+    budget.maxBytes = estimate / 2;
+    file = rive::File::import(bytes, &factory, nullptr, nullptr, &budget);
+    REQUIRE(file != nullptr);
+    CHECK(file->imageMemoryEstimate() == estimate);
+    CHECK(file->decodedImageMemory() <= budget.maxBytes);
+    CHECK(file->decodedImageMemory() == budget.usedBytes);
+    for (auto asset : file->assets())
+    {
+        REQUIRE(asset->is<rive::ImageAsset>());
+        CHECK(asset->as<rive::ImageAsset>()->renderImage() != nullptr);
+    }
+
+    // Without downsampling, whatever doesn't fit is deferred.
+    budget = rive::ImageBudget();
+    budget.maxBytes = estimate / 2;
+    budget.downsample = false;
+    file = rive::File::import(bytes, &factory, nullptr, nullptr, &budget);
+    REQUIRE(file != nullptr);
+    int deferred = 0;
+    for (auto asset : file->assets())
+    {
+        auto imageAsset = asset->as<rive::ImageAsset>();
+        if (imageAsset->isDeferred())
+        {
+            deferred++;
+            CHECK(imageAsset->renderImage() == nullptr);
+            CHECK(imageAsset->decodeDeferred(&factory));
+            CHECK(!imageAsset->isDeferred());
+            CHECK(imageAsset->decodedMemory() == imageAsset->imageHeader().decodedByteSize());
+        }
+    }
+    CHECK(deferred > 0);
+    CHECK(file->decodedImageMemory() == estimate);
+}
+
+// Like most platform factories, decodes at full size whatever it's asked for.
+class UnscaledFactory : public rive::SoftwareFactory
+{
+public:
+    rive::rcp<rive::RenderImage> decodeScaledImage(rive::Span<const uint8_t> bytes,
+                                                   uint32_t maxDimension) override
+    {
+        return SoftwareFactory::decodeScaledImage(bytes, 0);
+    }
+    bool canDecodeScaled() const override { return false; }
+};
+
+TEST_CASE("image budgets defer images factories can't downsample", "[assets]")
+{
+    UnscaledFactory factory;
+    auto bytes = ReadFile("../../test/assets/walle.riv");
+
+    auto file = rive::File::import(bytes, &factory);
+    REQUIRE(file != nullptr);
+    rive::ImageBudget budget;
+    budget.maxBytes = file->imageMemoryEstimate() / 2;
+    file = rive::File::import(bytes, &factory, nullptr, nullptr, &budget);
+    REQUIRE(file != nullptr);
+    // Nothing decoded at full size past the budget.
+    CHECK(file->decodedImageMemory() <= budget.maxBytes);
+    CHECK(file->decodedImageMemory() == budget.usedBytes);
+    int deferred = 0;
+    for (auto asset : file->assets())
+    {
+        auto imageAsset = asset->as<rive::ImageAsset>();
+        if (imageAsset->isDeferred())
+        {
+            deferred++;
+            CHECK(imageAsset->renderImage() == nullptr);
+        }
+    }
+    CHECK(deferred > 0);
+}
@@ -27,3 +27,100 @@ TEST_CASE("jpeg file decodes correctly", "[image-decoder]")
     REQUIRE(bitmap->width() == 350);
     REQUIRE(bitmap->height() == 200);
 }
+
+TEST_CASE("images downscale while decoding", "[image-decoder]")
+{
+    auto png = ReadFile("../../test/assets/placeholder.png");
+    auto jpeg = ReadFile("../../test/assets/open_source.jpg");
+
+    Bitmap::DecodeOptions options;
+    options.maxDimension = 64;
+    auto bitmap = Bitmap::decode(png.data(), png.size(), options);
+    REQUIRE(bitmap != nullptr);
+    CHECK(bitmap->width() == 64);
+    CHECK(bitmap->height() == 36);
+
+    options.maxDimension = 100;
+    bitmap = Bitmap::decode(jpeg.data(), jpeg.size(), options);
+    REQUIRE(bitmap != nullptr);
+    CHECK(bitmap->width() == 100);
+    CHECK(bitmap->height() == 57);
+    CHECK(bitmap->pixelFormat() == Bitmap::PixelFormat::RGB);
+
+    // Never scales up.
+    options.maxDimension = 1000;
+    bitmap = Bitmap::decode(jpeg.data(), jpeg.size(), options);
+    REQUIRE(bitmap != nullptr);
+    CHECK(bitmap->width() == 350);
+    CHECK(bitmap->height() == 200);
+
+    // A downscaled solid region keeps its color.
+    auto full = Bitmap::decode(png.data(), png.size());
+    options.maxDimension = 113;
+    auto half = Bitmap::decode(png.data(), png.size(), options);
+    REQUIRE(half->width() == 113);
+    REQUIRE(half->pixelFormat() == full->pixelFormat());
+    size_t bpp = Bitmap::bytesPerPixel(full->pixelFormat());
+    for (size_t c = 0; c < bpp; c++)
+    {
+        CHECK(std::abs((int)half->bytes()[c] - (int)full->bytes()[c]) <= 2);
+    }
+}
+
+TEST_CASE("images decode to a requested pixel format", "[image-decoder]")
+{
+    auto png = ReadFile("../../test/assets/placeholder.png");
+    auto bitmap = Bitmap::decode(png.data(), png.size());
+    REQUIRE(bitmap != nullptr);
+    bitmap->pixelFormat(Bitmap::PixelFormat::RGBA);
+
+    Bitmap::DecodeOptions options;
+    options.hasPixelFormat = true;
+    options.pixelFormat = Bitmap::PixelFormat::RGBAPremul;
+    auto premul = Bitmap::decode(png.data(), png.size(), options);
+    REQUIRE(premul != nullptr);
+    REQUIRE(premul->pixelFormat() == Bitmap::PixelFormat::RGBAPremul);
+    REQUIRE(premul->byteSize() == bitmap->byteSize());
+    for (size_t i = 0; i < bitmap->byteSize(); i += 4)
+    {
+        uint32_t alpha = bitmap->bytes()[i + 3];
+        REQUIRE(premul->bytes()[i + 3] == alpha);
+        for (size_t c = 0; c < 3; c++)
+        {
+            int expected = (bitmap->bytes()[i + c] * alpha + 127) / 255;
+            REQUIRE(std::abs(premul->bytes()[i + c] - expected) <= 1);
+        }
+    }
+
+    // RGB -> RGBA -> RGB round trips.
+    auto jpeg = ReadFile("../../test/assets/open_source.jpg");
+    auto rgb = Bitmap::decode(jpeg.data(), jpeg.size());
+    auto converted = Bitmap::decode(jpeg.data(), jpeg.size());
+    converted->pixelFormat(Bitmap::PixelFormat::RGBA);
+    converted->pixelFormat(Bitmap::PixelFormat::RGB);
+    CHECK(memcmp(rgb->bytes(), converted->bytes(), rgb->byteSize()) == 0);
+}
+
+TEST_CASE("images decode into caller memory", "[image-decoder]")
+{
+    auto jpeg = ReadFile("../../test/assets/open_source.jpg");
+    auto bitmap = Bitmap::decode(jpeg.data(), jpeg.size());
+    REQUIRE(bitmap != nullptr);
+
+    std::vector<uint8_t> pixels;
+    uint32_t width = 0, height = 0;
+    auto allocate = [&](uint32_t w, uint32_t h, Bitmap::PixelFormat format) {
+        width = w;
+        height = h;
+        pixels.resize(w * h * Bitmap::bytesPerPixel(format));
+        return pixels.data();
+    };
+    REQUIRE(Bitmap::decode(jpeg.data(), jpeg.size(), Bitmap::DecodeOptions(), allocate));
+    CHECK(width == bitmap->width());
+    CHECK(height == bitmap->height());
+    REQUIRE(pixels.size() == bitmap->byteSize());
+    CHECK(memcmp(pixels.data(), bitmap->bytes(), pixels.size()) == 0);
+
+    auto refuse = [](uint32_t, uint32_t, Bitmap::PixelFormat) -> uint8_t* { return nullptr; };
+    CHECK(!Bitmap::decode(jpeg.data(), jpeg.size(), Bitmap::DecodeOptions(), refuse));
+}
@@ -1,4 +1,5 @@
 #include <catch.hpp>
+#include "rive/math/decompose_cache.hpp"
 #include "rive/math/mat2d.hpp"
 #include "rive/math/math_types.hpp"
 
@@ -255,4 +256,25 @@ TEST_CASE("mapBoundingBox", "[Mat2D]")
     CHECK(Mat2D().mapBoundingBox(AABB{inf, 0, inf, 0}).width() == 0);
     CHECK(Mat2D().mapBoundingBox(AABB{0, -inf, 0, -inf}).height() == 0);
 }
+
+TEST_CASE("DecomposeCache", "[Mat2D]")
+{
+    DecomposeCache cache;
+    Mat2D a = Mat2D::fromRotation(0.5f).scale({2.0f, 3.0f});
+    a[4] = 10.0f;
+    const TransformComponents& components = cache.decompose(a);
+    CHECK(components.rotation() == a.decompose().rotation());
+    CHECK(components.scaleX() == a.decompose().scaleX());
+    CHECK(components.x() == 10.0f);
+
+    // Same matrix again reuses the stored components.
+    CHECK(&cache.decompose(a) == &components);
+    CHECK(cache.decompose(a).rotation() == a.decompose().rotation());
+
+    // A different matrix is decomposed again.
+    Mat2D b = Mat2D::fromRotation(-1.0f);
+    CHECK(cache.decompose(b).rotation() == b.decompose().rotation());
+    CHECK(cache.decompose(b).x() == 0.0f);
+}
+
 } // namespace rive
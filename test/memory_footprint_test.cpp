@@ -0,0 +1,61 @@
+#include <catch.hpp>
+#include <rive/artboard.hpp>
+#include <rive/file.hpp>
+#include <rive/memory_footprint.hpp>
+#include <rive/shapes/shape.hpp>
+#include <rive/generated/core_registry.hpp>
+#include <utils/no_op_renderer.hpp>
+#include "rive_file_reader.hpp"
+
+using namespace rive;
+
+TEST_CASE("core objects report their concrete size", "[memory]")
+{
+    CHECK(CoreRegistry::objectSize(Shape::typeKey) == sizeof(Shape));
+    CHECK(CoreRegistry::objectSize(Artboard::typeKey) == sizeof(Artboard));
+    CHECK(CoreRegistry::objectSize(-1) == 0);
+
+    Shape shape;
+    CHECK(MemoryFootprint::objectSize(&shape) == sizeof(Shape));
+}
+
+TEST_CASE("memory footprint totals its categories", "[memory]")
+{
+    MemoryFootprint a;
+    a.coreObjects = 1;
+    a.keyframes = 2;
+    a.vertexData = 3;
+    a.renderPaths = 4;
+    a.images = 5;
+    a.fonts = 6;
+    a.textShaping = 7;
+    CHECK(a.total() == 28);
+
+    MemoryFootprint b;
+    b += a;
+    b += a;
+    CHECK(b.total() == 56);
+    CHECK(b.keyframes == 4);
+}
+
+TEST_CASE("files and instances account for their memory", "[memory]")
+{
+    auto file = ReadRiveFile("../../test/assets/juice.riv");
+    MemoryFootprint fileFootprint = file->memoryFootprint();
+    CHECK(fileFootprint.coreObjects > 0);
+    // The source artboards hold the animations.
+    CHECK(fileFootprint.keyframes > 0);
+    CHECK(fileFootprint.vertexData > 0);
+
+    auto artboard = file->artboardDefault();
+    MemoryFootprint instanceFootprint = artboard->memoryFootprint();
+    CHECK(instanceFootprint.coreObjects > 0);
+    CHECK(instanceFootprint.vertexData > 0);
+    // Instances share animations with their source.
+    CHECK(instanceFootprint.keyframes == 0);
+    CHECK(instanceFootprint.total() < fileFootprint.total());
+
+    // A second instance costs the same.
+    auto other = file->artboardDefault();
+    CHECK(other->memoryFootprint().total() == instanceFootprint.total());
+}
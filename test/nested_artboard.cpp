@@ -5,6 +5,8 @@
 #include <rive/animation/state_machine_instance.hpp>
 #include <rive/animation/nested_linear_animation.hpp>
 #include <rive/animation/nested_state_machine.hpp>
+#include <rive/shapes/paint/shape_paint.hpp>
+#include <utils/no_op_renderer.hpp>
 #include "rive_file_reader.hpp"
 #include "rive_testing.hpp"
 #include <catch.hpp>
@@ -63,4 +65,139 @@ TEST_CASE("nested artboards with one shot animations will not main advanceAndApp
     REQUIRE(stateMachine->advanceAndApply(0.1f) == true);
     // nested artboards animation is 1s long
     REQUIRE(stateMachine->advanceAndApply(0.1f) == false);
-}
\ No newline at end of file
+}
+
+TEST_CASE("static nested artboards can share an instance", "[nested]")
+{
+    auto file = ReadRiveFile("../../test/assets/bullet_man.riv");
+    {
+        // Off by default.
+        auto artboard = file->artboard("Bullet Man")->instance();
+        for (auto nested : artboard->nestedArtboards())
+        {
+            REQUIRE(!nested->isSharedInstance());
+        }
+    }
+
+    file->shareStaticNestedArtboards(true);
+    auto first = file->artboard("Bullet Man")->instance();
+    auto second = file->artboard("Bullet Man")->instance();
+    auto firstNests = first->nestedArtboards();
+    auto secondNests = second->nestedArtboards();
+    REQUIRE(firstNests.size() == secondNests.size());
+    int sharedCount = 0;
+    for (size_t i = 0; i < firstNests.size(); i++)
+    {
+        REQUIRE(firstNests[i]->isSharedInstance() == secondNests[i]->isSharedInstance());
+        if (firstNests[i]->isSharedInstance())
+        {
+            sharedCount++;
+            REQUIRE(firstNests[i]->artboard() == secondNests[i]->artboard());
+            REQUIRE(firstNests[i]->nestedAnimations().empty());
+        }
+        else
+        {
+            // Nests with their own animations keep private state.
+            REQUIRE(firstNests[i]->artboard() != secondNests[i]->artboard());
+        }
+    }
+    REQUIRE(sharedCount == 1);
+
+    // Nests never advance or change the shared instance.
+    rive::ArtboardInstance* shared = nullptr;
+    for (auto nested : firstNests)
+    {
+        if (nested->isSharedInstance())
+        {
+            shared = nested->artboard();
+        }
+    }
+    REQUIRE(shared != nullptr);
+    shared->stats().reset();
+    rive::NoOpRenderer renderer;
+    first->advance(0.1f);
+    first->draw(&renderer);
+    second->advance(0.1f);
+    second->draw(&renderer);
+    REQUIRE(shared->stats().componentsUpdated == 0);
+    REQUIRE(shared->opacity() == 1.0f);
+}
+
+TEST_CASE("translucent nests don't share an instance", "[nested]")
+{
+    auto file = ReadRiveFile("../../test/assets/nested_artboard_opacity.riv");
+    file->shareStaticNestedArtboards(true);
+    auto artboard = file->artboard()->instance();
+    auto nested = artboard->find<rive::NestedArtboard>("Nested artboard container");
+    REQUIRE(nested != nullptr);
+    REQUIRE(nested->isSharedInstance());
+    auto shared = file->artboard(nested->artboard()->name())->sharedInstance();
+
+    // The nest is drawn translucent so it takes an instance of its own once
+    // its render opacity is known, leaving the shared one untouched.
+    artboard->advance(0.0f);
+    REQUIRE(!nested->isSharedInstance());
+    REQUIRE(nested->artboard() != shared.get());
+    REQUIRE(shared->opacity() == 1.0f);
+
+    rive::NoOpRenderer renderer;
+    artboard->draw(&renderer);
+    auto paints = nested->artboard()->shapePaints();
+    REQUIRE(paints.size() == 1);
+    REQUIRE(paints[0]->renderOpacity() == Approx(0.3275f));
+}
+
+TEST_CASE("nested artboards outside the viewport can be paused", "[nested]")
+{
+    auto file = ReadRiveFile("../../test/assets/solos_with_nested_artboards.riv");
+    auto artboard = file->artboard("main-artboard")->instance();
+    auto stateMachine = artboard->stateMachineAt(0);
+    stateMachine->advanceAndApply(0.0f);
+
+    auto redNestedArtboard = artboard->find<rive::NestedArtboard>("red-artboard");
+    auto redRect = redNestedArtboard->artboard()->find<rive::Shape>().at(0);
+    REQUIRE(redNestedArtboard->isInViewport());
+    float startX = redRect->x();
+
+    artboard->viewport(rive::AABB(-10000.0f, -10000.0f, -9000.0f, -9000.0f));
+    artboard->offscreenNestedAdvance(rive::Artboard::OffscreenAdvance::kPause);
+    REQUIRE(!redNestedArtboard->isInViewport());
+    artboard->advance(0.5f);
+    REQUIRE(redRect->x() == startX);
+    // Paused nests don't keep the host advancing.
+    REQUIRE(!redNestedArtboard->advance(0.5f));
+    REQUIRE(!artboard->advance(0.5f));
+    REQUIRE(redRect->x() == startX);
+
+    // Moving the viewport wakes the host, back on screen the nest picks up
+    // where it left off.
+    artboard->viewport(artboard->bounds());
+    REQUIRE(redNestedArtboard->isInViewport());
+    REQUIRE(artboard->advance(0.5f));
+    REQUIRE(redRect->x() > startX);
+}
+
+TEST_CASE("throttled nested artboards catch up on elapsed time", "[nested]")
+{
+    auto file = ReadRiveFile("../../test/assets/solos_with_nested_artboards.riv");
+    auto throttled = file->artboard("main-artboard")->instance();
+    auto reference = file->artboard("main-artboard")->instance();
+    throttled->advance(0.0f);
+    reference->advance(0.0f);
+    auto throttledRect =
+        throttled->find<rive::NestedArtboard>("red-artboard")->artboard()->find<rive::Shape>().at(0);
+    auto referenceRect =
+        reference->find<rive::NestedArtboard>("red-artboard")->artboard()->find<rive::Shape>().at(0);
+
+    throttled->viewport(rive::AABB(-10000.0f, -10000.0f, -9000.0f, -9000.0f));
+    throttled->offscreenNestedAdvance(rive::Artboard::OffscreenAdvance::kThrottle, 0.3f);
+    float startX = throttledRect->x();
+    throttled->advance(0.1f);
+    reference->advance(0.1f);
+    throttled->advance(0.1f);
+    reference->advance(0.1f);
+    REQUIRE(throttledRect->x() == startX);
+    throttled->advance(0.1f);
+    reference->advance(0.1f);
+    REQUIRE(throttledRect->x() == Approx(referenceRect->x()));
+}
@@ -0,0 +1,107 @@
+#include <catch.hpp>
+#include <rive/math/random.hpp>
+#include <rive/animation/layer_state.hpp>
+#include <rive/animation/layer_state_flags.hpp>
+#include <rive/animation/state_machine.hpp>
+#include <rive/animation/state_machine_input_instance.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/animation/state_machine_layer.hpp>
+#include <rive/animation/state_transition.hpp>
+#include <rive/animation/transition_number_condition.hpp>
+#include <rive/file.hpp>
+#include "rive_file_reader.hpp"
+#include <vector>
+
+using namespace rive;
+
+TEST_CASE("random sequences are reproducible from a seed", "[random]")
+{
+    Random a(1234);
+    Random b(1234);
+    for (int i = 0; i < 1000; i++)
+    {
+        REQUIRE(a.nextU32() == b.nextU32());
+    }
+
+    // Re-seeding restarts the sequence.
+    Random c(1234);
+    uint32_t first = c.nextU32();
+    c.nextU32();
+    c.seed(1234);
+    CHECK(c.nextU32() == first);
+}
+
+TEST_CASE("different seeds produce different sequences", "[random]")
+{
+    Random a(1);
+    Random b(2);
+    int matches = 0;
+    for (int i = 0; i < 100; i++)
+    {
+        if (a.nextU32() == b.nextU32())
+        {
+            matches++;
+        }
+    }
+    CHECK(matches < 2);
+}
+
+TEST_CASE("random doubles are in [0, 1)", "[random]")
+{
+    Random random(42);
+    double sum = 0.0;
+    const int count = 10000;
+    for (int i = 0; i < count; i++)
+    {
+        double value = random.nextDouble();
+        REQUIRE(value >= 0.0);
+        REQUIRE(value < 1.0);
+        sum += value;
+    }
+    // Should be roughly uniform.
+    CHECK(sum / count == Approx(0.5).margin(0.02));
+}
+
+// The states a seeded machine changes to over a number of frames.
+static std::vector<const LayerState*> randomStateChanges(File* file, uint64_t seed)
+{
+    auto artboard = file->artboard("MC Main Artboard")->instance();
+    auto machine = artboard->stateMachineAt(0);
+    machine->seedRandom(seed);
+    machine->getNumber("Direction")->value(1.0f);
+    std::vector<const LayerState*> changes;
+    for (int i = 0; i < 120; i++)
+    {
+        machine->advanceAndApply(1.0f / 60.0f);
+        for (size_t j = 0; j < machine->stateChangedCount(); j++)
+        {
+            changes.push_back(machine->stateChangedByIndex(j));
+        }
+    }
+    return changes;
+}
+
+TEST_CASE("seeded state machines pick the same random transitions", "[random]")
+{
+    auto file = ReadRiveFile("../../test/assets/death_knight.riv");
+    // Make the direction layer's any state pick randomly between its four
+    // transitions, all of which pass once they share a condition. Mixing
+    // for 100ms keeps it from changing again straight away.
+    auto layer = file->artboard("MC Main Artboard")->stateMachine(0)->layer(2);
+    auto anyState = layer->state(2);
+    REQUIRE(anyState->transitionCount() == 4);
+    anyState->flags(anyState->flags() | (uint32_t)LayerStateFlags::Random);
+    for (size_t i = 0; i < anyState->transitionCount(); i++)
+    {
+        auto transition = anyState->transition(i);
+        REQUIRE(transition->conditionCount() == 1);
+        REQUIRE(transition->condition(0)->is<TransitionNumberCondition>());
+        transition->condition(0)->as<TransitionNumberCondition>()->value(1.0f);
+        transition->duration(100);
+    }
+
+    auto changes = randomStateChanges(file.get(), 1234);
+    REQUIRE(changes.size() > 10);
+    CHECK(randomStateChanges(file.get(), 1234) == changes);
+    CHECK(randomStateChanges(file.get(), 4321) != changes);
+}
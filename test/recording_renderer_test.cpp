@@ -0,0 +1,197 @@
+#include <catch.hpp>
+#include <rive/artboard.hpp>
+#include <rive/file.hpp>
+#include <rive/math/raw_path.hpp>
+#include <rive/recording_renderer.hpp>
+#include <rive/shapes/paint/shape_paint.hpp>
+#include <rive/text/text_style.hpp>
+#include <software_renderer.hpp>
+#include "rive_file_reader.hpp"
+
+#include <algorithm>
+
+#include <string>
+#include <thread>
+
+using namespace rive;
+
+namespace
+{
+// Logs every call so two command streams can be compared.
+class LoggingRenderer : public Renderer
+{
+public:
+    std::vector<std::string> log;
+
+    void save() override { log.push_back("save"); }
+    void restore() override { log.push_back("restore"); }
+    void transform(const Mat2D& m) override
+    {
+        log.push_back("transform " + std::to_string(m[0]) + " " + std::to_string(m[1]) + " " +
+                      std::to_string(m[2]) + " " + std::to_string(m[3]) + " " +
+                      std::to_string(m[4]) + " " + std::to_string(m[5]));
+    }
+    void drawPath(RenderPath* path, RenderPaint* paint) override
+    {
+        log.push_back("drawPath " + pointer(path) + " " + pointer(paint));
+    }
+    void clipPath(RenderPath* path) override { log.push_back("clipPath " + pointer(path)); }
+    void drawImage(const RenderImage* image, BlendMode blendMode, float opacity) override
+    {
+        log.push_back("drawImage " + pointer(image) + " " + std::to_string((int)blendMode) + " " +
+                      std::to_string(opacity));
+    }
+    void drawImageMesh(const RenderImage* image,
+                       rcp<RenderBuffer> vertices,
+                       rcp<RenderBuffer> uvs,
+                       rcp<RenderBuffer> indices,
+                       uint32_t vertexCount,
+                       uint32_t indexCount,
+                       BlendMode blendMode,
+                       float opacity) override
+    {
+        log.push_back("drawImageMesh " + pointer(image) + " " + pointer(vertices.get()) + " " +
+                      pointer(uvs.get()) + " " + pointer(indices.get()) + " " +
+                      std::to_string(vertexCount) + " " + std::to_string(indexCount) + " " +
+                      std::to_string((int)blendMode) + " " + std::to_string(opacity));
+    }
+
+private:
+    static std::string pointer(const void* ptr) { return std::to_string((uintptr_t)ptr); }
+};
+} // namespace
+
+TEST_CASE("recorded artboards replay the same commands", "[recording]")
+{
+    auto file = ReadRiveFile("../../test/assets/circle_clips.riv");
+    auto artboard = file->artboardDefault();
+    artboard->advance(0.0f);
+
+    LoggingRenderer direct;
+    artboard->draw(&direct);
+    REQUIRE(!direct.log.empty());
+
+    RecordingRenderer recording;
+    artboard->draw(&recording);
+    CHECK(recording.commandCount() == direct.log.size());
+
+    // Replays don't consume the recording.
+    for (int i = 0; i < 2; i++)
+    {
+        LoggingRenderer replayed;
+        recording.replay(&replayed);
+        CHECK(replayed.log == direct.log);
+    }
+
+    // Clearing keeps the arena around for the next frame.
+    size_t byteSize = recording.byteSize();
+    CHECK(byteSize > 0);
+    recording.clear();
+    CHECK(recording.empty());
+    CHECK(recording.byteSize() == 0);
+    artboard->draw(&recording);
+    CHECK(recording.byteSize() == byteSize);
+}
+
+TEST_CASE("recordings retain what they reference", "[recording]")
+{
+    RecordingRenderer recording;
+    Factory* factory = &gNoOpFactory;
+    auto paint = factory->makeRenderPaint();
+    auto path = factory->makeEmptyRenderPath();
+    CHECK(paint->debugging_refcnt() == 1);
+    // Spill across several arena blocks.
+    for (int i = 0; i < 10000; i++)
+    {
+        recording.save();
+        recording.transform(Mat2D::fromTranslate((float)i, 0.0f));
+        recording.drawPath(path.get(), paint.get());
+        recording.restore();
+    }
+    CHECK(paint->debugging_refcnt() == 10001);
+    CHECK(recording.commandCount() == 40000);
+
+    LoggingRenderer replayed;
+    recording.replay(&replayed);
+    REQUIRE(replayed.log.size() == 40000);
+    CHECK(replayed.log[40000 - 3] == "transform 1.000000 0.000000 0.000000 1.000000 9999.000000 "
+                                     "0.000000");
+
+    RecordingRenderer moved(std::move(recording));
+    CHECK(recording.empty());
+    CHECK(moved.commandCount() == 40000);
+    moved.clear();
+    CHECK(paint->debugging_refcnt() == 1);
+    CHECK(path->debugging_refcnt() == 1);
+}
+
+TEST_CASE("artboards can be recorded on worker threads", "[recording]")
+{
+    auto file = ReadRiveFile("../../test/assets/circle_clips.riv");
+    auto artboardA = file->artboardDefault();
+    auto artboardB = file->artboardDefault();
+    artboardA->advance(0.0f);
+    artboardB->advance(0.0f);
+
+    RecordingRenderer recordingA;
+    RecordingRenderer recordingB;
+    std::thread threadA([&]() { artboardA->draw(&recordingA); });
+    std::thread threadB([&]() { artboardB->draw(&recordingB); });
+    threadA.join();
+    threadB.join();
+
+    LoggingRenderer direct;
+    artboardA->draw(&direct);
+    LoggingRenderer replayed;
+    recordingA.replay(&replayed);
+    CHECK(replayed.log == direct.log);
+    CHECK(recordingB.commandCount() == recordingA.commandCount());
+}
+
+TEST_CASE("replayed text modifier paths keep each paint's state", "[recording]")
+{
+    SoftwareFactory factory;
+    auto file = ReadRiveFile("../../test/assets/new_text.riv", &factory);
+    auto artboard = file->artboardDefault();
+    artboard->advance(0.0f);
+
+    // A style with a fill and strokes.
+    TextStyle* style = nullptr;
+    for (auto textStyle : artboard->find<TextStyle>())
+    {
+        if (textStyle->shapePaints().size() > 1)
+        {
+            style = textStyle;
+        }
+    }
+    REQUIRE(style != nullptr);
+
+    // Modifiers draw glyphs with partial opacity through the style's paint
+    // pool.
+    RawPath rect;
+    rect.addRect(AABB(10.0f, 10.0f, 40.0f, 40.0f));
+    RawPath other;
+    other.addRect(AABB(50.0f, 50.0f, 90.0f, 90.0f));
+    style->rewindPath();
+    style->addPath(rect, 0.5f);
+    style->addPath(other, 0.25f);
+
+    SoftwareRenderer direct(100, 100);
+    style->draw(&direct);
+    direct.flush();
+
+    RecordingRenderer recording;
+    style->draw(&recording);
+    SoftwareRenderer replayed(100, 100);
+    recording.replay(&replayed);
+    replayed.flush();
+
+    size_t byteCount = 100 * 100 * 4;
+    CHECK(std::equal(direct.pixels(), direct.pixels() + byteCount, replayed.pixels()));
+    size_t drawn = 0;
+    for (size_t i = 3; i < byteCount; i += 4)
+    {
+        drawn += direct.pixels()[i] != 0;
+    }
+    CHECK(drawn > 0);
+}
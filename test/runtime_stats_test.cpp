@@ -0,0 +1,103 @@
+#include <catch.hpp>
+#include <rive/artboard.hpp>
+#include <rive/file.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/runtime_stats.hpp>
+#include <rive/shapes/mesh.hpp>
+#include <utils/no_op_renderer.hpp>
+#include "rive_file_reader.hpp"
+
+using namespace rive;
+
+TEST_CASE("artboards count the work they do", "[stats]")
+{
+    auto file = ReadRiveFile("../../test/assets/juice.riv");
+    auto artboard = file->artboardDefault();
+    auto animation = artboard->animationAt(0);
+    REQUIRE(animation != nullptr);
+
+    // Instancing creates the artboard's render objects.
+    CHECK(artboard->stats().renderPathsCreated > 0);
+    CHECK(artboard->stats().renderPaintsCreated > 0);
+
+    artboard->stats().reset();
+    artboard->advance(0.0f);
+    RuntimeStats first = artboard->stats();
+    CHECK(first.componentsUpdated > 0);
+    CHECK(first.pathsRebuilt > 0);
+    CHECK(first.hitTests == 0);
+
+    // Nothing is dirty, so nothing updates.
+    artboard->stats().reset();
+    artboard->advance(0.0f);
+    CHECK(artboard->stats().componentsUpdated == 0);
+    CHECK(artboard->stats().pathsRebuilt == 0);
+
+    // Animating only updates what changed.
+    artboard->stats().reset();
+    animation->advanceAndApply(0.1f);
+    CHECK(artboard->stats().componentsUpdated > 0);
+    CHECK(artboard->stats().componentsUpdated < first.componentsUpdated);
+
+    // Drawing an updated artboard creates nothing.
+    artboard->stats().reset();
+    NoOpRenderer renderer;
+    artboard->draw(&renderer);
+    CHECK(artboard->stats().renderPathsCreated == 0);
+    CHECK(artboard->stats().renderPaintsCreated == 0);
+}
+
+TEST_CASE("state machines count transitions and hit tests", "[stats]")
+{
+    auto file = ReadRiveFile("../../test/assets/hit_test_solos.riv");
+    auto artboard = file->artboardDefault();
+    auto stateMachine = artboard->stateMachineAt(0);
+    REQUIRE(stateMachine != nullptr);
+    stateMachine->advanceAndApply(0.0f);
+
+    // Entering the entry state counts.
+    CHECK(stateMachine->stats().stateTransitions > 0);
+    CHECK(stateMachine->stats().hitTests == 0);
+    CHECK(stateMachine->stats().componentsUpdated == 0);
+
+    stateMachine->stats().reset();
+    stateMachine->pointerMove(Vec2D(200.0f, 100.0f));
+    uint32_t hitTests = stateMachine->stats().hitTests;
+    CHECK(hitTests > 0);
+    stateMachine->pointerMove(Vec2D(200.0f, 300.0f));
+    CHECK(stateMachine->stats().hitTests == hitTests * 2);
+
+    RuntimeStats total;
+    total += stateMachine->stats();
+    total += artboard->stats();
+    CHECK(total.hitTests == hitTests * 2);
+    CHECK(total.componentsUpdated == artboard->stats().componentsUpdated);
+}
+
+TEST_CASE("instances count their own render buffers", "[stats]")
+{
+    auto file = ReadRiveFile("../../test/assets/tape.riv");
+    auto source = file->artboard();
+    RuntimeStats sourceStats = source->stats();
+
+    auto first = file->artboardDefault();
+    RuntimeStats firstStats = first->stats();
+    auto second = file->artboardDefault();
+    RuntimeStats secondStats = second->stats();
+
+    // Each instance makes its own vertex buffers, the source isn't charged.
+    auto meshes = first->find<Mesh>();
+    REQUIRE(meshes.size() == 3);
+    size_t vertexBytes = 0;
+    for (auto mesh : meshes)
+    {
+        vertexBytes += mesh->vertices().size() * sizeof(Vec2D);
+    }
+    CHECK(firstStats.renderBuffersCreated == meshes.size());
+    CHECK(firstStats.renderBufferBytes == vertexBytes);
+    CHECK(secondStats.renderBuffersCreated == firstStats.renderBuffersCreated);
+    CHECK(secondStats.renderBufferBytes == firstStats.renderBufferBytes);
+    CHECK(first->stats().renderBuffersCreated == firstStats.renderBuffersCreated);
+    CHECK(source->stats().renderBuffersCreated == sourceStats.renderBuffersCreated);
+    CHECK(source->stats().renderBufferBytes == sourceStats.renderBufferBytes);
+}
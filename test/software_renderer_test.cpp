@@ -0,0 +1,185 @@
+#include <catch.hpp>
+#include <rive/artboard.hpp>
+#include <rive/file.hpp>
+#include <rive/math/raw_path.hpp>
+#include <software_renderer.hpp>
+#include "rive_file_reader.hpp"
+
+using namespace rive;
+
+static rcp<RenderPath> makeRect(Factory* factory,
+                                float l,
+                                float t,
+                                float r,
+                                float b,
+                                FillRule fillRule = FillRule::nonZero)
+{
+    RawPath rawPath;
+    rawPath.addRect({l, t, r, b});
+    return factory->makeRenderPath(rawPath, fillRule);
+}
+
+static rcp<RenderPaint> makePaint(Factory* factory, ColorInt color)
+{
+    auto paint = factory->makeRenderPaint();
+    paint->color(color);
+    return paint;
+}
+
+static int channel(ColorInt color, int shift) { return (color >> shift) & 0xff; }
+
+TEST_CASE("software renderer fills paths with coverage", "[software]")
+{
+    SoftwareFactory factory;
+    SoftwareRenderer renderer(32, 32);
+    renderer.clear(0xffffffff);
+
+    auto path = makeRect(&factory, 4.0f, 4.0f, 12.5f, 12.0f);
+    auto paint = makePaint(&factory, 0xffff0000);
+    renderer.drawPath(path.get(), paint.get());
+    renderer.flush();
+
+    CHECK(renderer.pixel(8, 8) == 0xffff0000);
+    CHECK(renderer.pixel(2, 8) == 0xffffffff);
+    CHECK(renderer.pixel(20, 20) == 0xffffffff);
+    // Half covered column blends halfway to the background.
+    ColorInt edge = renderer.pixel(12, 8);
+    CHECK(channel(edge, 16) == 255);
+    CHECK(channel(edge, 8) == Approx(128).margin(2));
+}
+
+TEST_CASE("software renderer honors fill rules", "[software]")
+{
+    SoftwareFactory factory;
+    for (FillRule fillRule : {FillRule::nonZero, FillRule::evenOdd})
+    {
+        SoftwareRenderer renderer(32, 32);
+        RawPath rawPath;
+        rawPath.addRect({0.0f, 0.0f, 32.0f, 32.0f});
+        rawPath.addRect({8.0f, 8.0f, 24.0f, 24.0f});
+        auto path = factory.makeRenderPath(rawPath, fillRule);
+        auto paint = makePaint(&factory, 0xff0000ff);
+        renderer.drawPath(path.get(), paint.get());
+        renderer.flush();
+
+        CHECK(renderer.pixel(2, 2) == 0xff0000ff);
+        CHECK(renderer.pixel(16, 16) == (fillRule == FillRule::nonZero ? 0xff0000ff : 0u));
+    }
+}
+
+TEST_CASE("software renderer strokes, clips and transforms", "[software]")
+{
+    SoftwareFactory factory;
+    SoftwareRenderer renderer(64, 64);
+
+    // A 4px wide stroke centered on x = 10 (scaled by 2).
+    renderer.save();
+    renderer.transform(Mat2D::fromScale(2.0f, 2.0f));
+    RawPath rawPath;
+    rawPath.moveTo(5.0f, 2.0f);
+    rawPath.lineTo(5.0f, 30.0f);
+    auto line = factory.makeRenderPath(rawPath, FillRule::nonZero);
+    auto stroke = makePaint(&factory, 0xff00ff00);
+    stroke->style(RenderPaintStyle::stroke);
+    stroke->thickness(2.0f);
+    renderer.drawPath(line.get(), stroke.get());
+    renderer.restore();
+
+    // Clip a full canvas fill to the right half.
+    renderer.save();
+    auto clip = makeRect(&factory, 32.0f, 0.0f, 64.0f, 64.0f);
+    renderer.clipPath(clip.get());
+    auto fill = makeRect(&factory, 0.0f, 0.0f, 64.0f, 64.0f);
+    auto paint = makePaint(&factory, 0xffff0000);
+    renderer.drawPath(fill.get(), paint.get());
+    renderer.restore();
+    renderer.flush();
+
+    CHECK(renderer.pixel(9, 20) == 0xff00ff00);
+    CHECK(renderer.pixel(10, 20) == 0xff00ff00);
+    CHECK(renderer.pixel(6, 20) == 0u);
+    CHECK(renderer.pixel(14, 20) == 0u);
+    CHECK(renderer.pixel(20, 20) == 0u);
+    CHECK(renderer.pixel(40, 20) == 0xffff0000);
+}
+
+TEST_CASE("software renderer shades gradients and blends", "[software]")
+{
+    SoftwareFactory factory;
+    SoftwareRenderer renderer(256, 4);
+
+    ColorInt colors[] = {0xff000000, 0xffffffff};
+    float stops[] = {0.0f, 1.0f};
+    auto paint = factory.makeRenderPaint();
+    paint->shader(factory.makeLinearGradient(0.0f, 0.0f, 256.0f, 0.0f, colors, stops, 2));
+    auto path = makeRect(&factory, 0.0f, 0.0f, 256.0f, 4.0f);
+    renderer.drawPath(path.get(), paint.get());
+    renderer.flush();
+
+    CHECK(channel(renderer.pixel(0, 1), 0) < 4);
+    CHECK(channel(renderer.pixel(128, 1), 0) == Approx(128).margin(3));
+    CHECK(channel(renderer.pixel(255, 1), 0) > 251);
+
+    // Multiply by 50% grey halves every channel.
+    auto grey = makePaint(&factory, 0xff808080);
+    grey->blendMode(BlendMode::multiply);
+    renderer.drawPath(path.get(), grey.get());
+    renderer.flush();
+    CHECK(channel(renderer.pixel(255, 1), 0) == Approx(128).margin(3));
+    CHECK(channel(renderer.pixel(128, 1), 0) == Approx(64).margin(3));
+}
+
+TEST_CASE("software renderer draws images", "[software]")
+{
+    SoftwareFactory factory;
+    std::vector<uint8_t> pixels(4 * 4 * 4, 0);
+    for (size_t i = 0; i < pixels.size(); i += 4)
+    {
+        pixels[i + 2] = 255;
+        pixels[i + 3] = 255;
+    }
+    auto image = factory.makeImage(4, 4, std::move(pixels));
+    REQUIRE(image != nullptr);
+
+    SoftwareRenderer renderer(16, 16);
+    renderer.transform(Mat2D::fromTranslate(4.0f, 4.0f));
+    renderer.drawImage(image.get(), BlendMode::srcOver, 0.5f);
+    renderer.flush();
+
+    ColorInt color = renderer.pixel(5, 5);
+    CHECK(channel(color, 24) == Approx(128).margin(1));
+    CHECK(channel(color, 0) == Approx(128).margin(1));
+    CHECK(renderer.pixel(9, 9) == 0u);
+}
+
+TEST_CASE("software renderer output does not depend on thread count", "[software]")
+{
+    SoftwareFactory factory;
+    auto file = ReadRiveFile("../../test/assets/circle_clips.riv", &factory);
+    auto artboard = file->artboardDefault();
+    REQUIRE(artboard != nullptr);
+    artboard->advance(0.0f);
+
+    SoftwareRenderer single(200, 200, 1);
+    SoftwareRenderer threaded(200, 200, 4);
+    for (SoftwareRenderer* renderer : {&single, &threaded})
+    {
+        renderer->save();
+        renderer->align(Fit::contain,
+                        Alignment::center,
+                        AABB(0.0f, 0.0f, 200.0f, 200.0f),
+                        artboard->bounds());
+        artboard->draw(renderer);
+        renderer->restore();
+        renderer->flush();
+    }
+
+    size_t byteCount = 200 * 200 * 4;
+    CHECK(std::equal(single.pixels(), single.pixels() + byteCount, threaded.pixels()));
+    size_t drawn = 0;
+    for (size_t i = 3; i < byteCount; i += 4)
+    {
+        drawn += single.pixels()[i] != 0;
+    }
+    CHECK(drawn > 0);
+}
@@ -0,0 +1,62 @@
+#include <catch.hpp>
+#include <rive/spsc_queue.hpp>
+#include <thread>
+
+using namespace rive;
+
+TEST_CASE("spsc queue pushes and pops in order", "[spsc]")
+{
+    SPSCQueue<int, 4> queue;
+    int value;
+    REQUIRE(queue.empty());
+    REQUIRE(!queue.pop(value));
+
+    for (int i = 0; i < 4; i++)
+    {
+        REQUIRE(queue.push(i));
+    }
+    REQUIRE(queue.full());
+    REQUIRE(!queue.push(4));
+
+    REQUIRE(queue.pop(value));
+    CHECK(value == 0);
+    REQUIRE(queue.push(4));
+
+    for (int i = 1; i <= 4; i++)
+    {
+        REQUIRE(queue.pop(value));
+        CHECK(value == i);
+    }
+    REQUIRE(queue.empty());
+}
+
+TEST_CASE("spsc queue hands values across threads", "[spsc]")
+{
+    SPSCQueue<uint32_t, 64> queue;
+    const uint32_t count = 200000;
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < count;)
+        {
+            if (queue.push(i))
+            {
+                i++;
+            }
+        }
+    });
+
+    uint32_t expected = 0;
+    bool inOrder = true;
+    while (expected < count)
+    {
+        uint32_t value;
+        if (queue.pop(value))
+        {
+            inOrder = inOrder && value == expected;
+            expected++;
+        }
+    }
+    producer.join();
+    CHECK(inOrder);
+    CHECK(queue.empty());
+}
@@ -0,0 +1,204 @@
+#include <catch.hpp>
+#include <rive/artboard.hpp>
+#include <rive/file.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/trace.hpp>
+#include <utils/no_op_renderer.hpp>
+#include "rive_file_reader.hpp"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rive;
+
+namespace
+{
+size_t countNamed(const std::vector<TraceEvent>& events, const char* name)
+{
+    size_t count = 0;
+    for (const TraceEvent& event : events)
+    {
+        count += std::string(event.name) == name;
+    }
+    return count;
+}
+} // namespace
+
+TEST_CASE("trace scopes only record while active", "[trace]")
+{
+    Trace::start();
+    Trace::stop();
+    {
+        TraceScope scope("inactive");
+    }
+    CHECK(Trace::events().empty());
+
+    std::string outer = "outer object";
+    Trace::start();
+    {
+        TraceScope scope("outer", &outer);
+        TraceScope inner("inner");
+    }
+    Trace::stop();
+    {
+        TraceScope scope("after stop");
+    }
+
+    auto events = Trace::events();
+    REQUIRE(events.size() == 2);
+    // Ordered by start, the enclosing scope first.
+    CHECK(std::string(events[0].name) == "outer");
+    CHECK(std::string(events[0].object) == "outer object");
+    CHECK(std::string(events[1].name) == "inner");
+    CHECK(std::string(events[1].object) == "");
+    CHECK(events[1].startNs >= events[0].startNs);
+    CHECK(events[1].startNs + events[1].durationNs <= events[0].startNs + events[0].durationNs);
+
+    // A new capture drops the previous one.
+    Trace::start();
+    Trace::stop();
+    CHECK(Trace::events().empty());
+}
+
+TEST_CASE("trace ring buffers keep the latest events", "[trace]")
+{
+    std::string names[10];
+    Trace::start(4);
+    for (int i = 0; i < 10; i++)
+    {
+        names[i] = std::to_string(i);
+        TraceScope scope("event", &names[i]);
+    }
+    Trace::stop();
+
+    auto events = Trace::events();
+    REQUIRE(events.size() == 4);
+    // Back to back scopes can share a timestamp on coarse clocks, so only
+    // which events survived is checked, not their order.
+    std::vector<std::string> kept;
+    for (const TraceEvent& event : events)
+    {
+        kept.push_back(event.object);
+    }
+    std::sort(kept.begin(), kept.end());
+    CHECK(kept == std::vector<std::string>(names + 6, names + 10));
+}
+
+TEST_CASE("trace records each thread separately", "[trace]")
+{
+    Trace::start();
+    {
+        TraceScope scope("main thread");
+    }
+    std::thread worker([] {
+        for (int i = 0; i < 3; i++)
+        {
+            TraceScope scope("worker thread");
+        }
+    });
+    worker.join();
+    Trace::stop();
+
+    auto events = Trace::events();
+    REQUIRE(countNamed(events, "main thread") == 1);
+    REQUIRE(countNamed(events, "worker thread") == 3);
+    uint32_t mainThread = 0;
+    for (const TraceEvent& event : events)
+    {
+        if (std::string(event.name) == "main thread")
+        {
+            mainThread = event.threadId;
+        }
+    }
+    for (const TraceEvent& event : events)
+    {
+        if (std::string(event.name) == "worker thread")
+        {
+            CHECK(event.threadId != mainThread);
+        }
+    }
+}
+
+TEST_CASE("trace exports chrome trace json", "[trace]")
+{
+    TraceEvent event = {};
+    event.name = "Artboard::draw";
+    event.startNs = 1500;
+    event.durationNs = 250;
+    event.threadId = 2;
+    strcpy(event.object, "say \"hi\"\\");
+
+    std::string json = Trace::chromeJson({event});
+    CHECK(json == "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+                  "{\"name\":\"Artboard::draw\",\"cat\":\"rive\",\"ph\":\"X\",\"pid\":1,"
+                  "\"tid\":2,\"ts\":1.500,\"dur\":0.250,"
+                  "\"args\":{\"object\":\"say \\\"hi\\\"\\\\\"}}\n"
+                  "]}\n");
+    CHECK(Trace::chromeJson(std::vector<TraceEvent>()) ==
+          "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n]}\n");
+}
+
+TEST_CASE("trace markers cover advancing and drawing", "[trace]")
+{
+    if (!Trace::compiledIn())
+    {
+        return;
+    }
+    auto file = ReadRiveFile("../../test/assets/hit_test_solos.riv");
+    auto artboard = file->artboardDefault();
+    auto machine = artboard->stateMachineAt(0);
+    REQUIRE(machine != nullptr);
+    NoOpRenderer renderer;
+
+    Trace::start();
+    for (int i = 0; i < 3; i++)
+    {
+        machine->advanceAndApply(1.0f / 60.0f);
+        artboard->draw(&renderer);
+    }
+    Trace::stop();
+
+    auto events = Trace::events();
+    CHECK(countNamed(events, "StateMachineInstance::advance") == 3);
+    CHECK(countNamed(events, "Artboard::draw") == 3);
+    CHECK(countNamed(events, "Artboard::updateComponents") >= 1);
+    CHECK(countNamed(events, "PathComposer::update") >= 1);
+    for (const TraceEvent& event : events)
+    {
+        if (std::string(event.name) == "Artboard::draw")
+        {
+            CHECK(std::string(event.object) == artboard->name());
+        }
+    }
+    std::string json = Trace::chromeJson(events);
+    CHECK(json.find("\"name\":\"Artboard::draw\"") != std::string::npos);
+}
+
+TEST_CASE("trace buffers can be released", "[trace]")
+{
+    Trace::start(16);
+    {
+        TraceScope scope("main thread");
+    }
+    std::thread worker([] { TraceScope scope("worker thread"); });
+    worker.join();
+    Trace::stop();
+    CHECK(Trace::bufferedBytes() >= 2 * 16 * sizeof(TraceEvent));
+    CHECK(Trace::events().size() == 2);
+
+    Trace::release();
+    CHECK(Trace::bufferedBytes() == 0);
+    CHECK(Trace::events().empty());
+
+    // Tracing picks back up after a release.
+    Trace::start(16);
+    {
+        TraceScope scope("again");
+    }
+    Trace::stop();
+    REQUIRE(Trace::events().size() == 1);
+    CHECK(std::string(Trace::events()[0].name) == "again");
+    Trace::release();
+}